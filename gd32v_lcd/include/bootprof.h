@@ -0,0 +1,21 @@
+#ifndef __BOOTPROF_H
+#define __BOOTPROF_H
+
+// Boot profiler: timestamps boot phases with the mtime counter
+// (SystemCoreClock/4, starts at 0 on reset) and prints them over UART.
+// Set BOOTPROF to 0 and the marks compile to nothing.
+
+#include <stdint.h>
+
+#define BOOTPROF        1
+#define BOOTPROF_MAX    12      // Marks kept
+
+#if BOOTPROF
+void BootProf_Mark(const char *phase);  // Call at the end of a phase
+void BootProf_Report(void);             // Print phases and total
+#else
+#define BootProf_Mark(phase)
+#define BootProf_Report()
+#endif
+
+#endif
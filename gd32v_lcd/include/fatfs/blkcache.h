@@ -0,0 +1,30 @@
+/*-----------------------------------------------------------------------/
+/  Sector cache between FatFs and the disk driver                        /
+/-----------------------------------------------------------------------*/
+
+#ifndef _BLKCACHE_H_
+#define _BLKCACHE_H_
+
+#include "diskio.h"
+
+#define BLKCACHE_LINES	4		/* Cache lines */
+#define BLKCACHE_SPL	2		/* Sectors per line: a miss reads this many, from the missing one on */
+#define BLKCACHE_PINS	2		/* Pinned sector ranges (FAT, root directory) */
+
+/* Driver read function: sectors to buff, like disk_read() without drive number */
+typedef DRESULT (*blkcache_read_fn)(BYTE *buff, DWORD sector, UINT count);
+
+typedef struct {
+	DWORD hits;			/* Sectors served from the cache */
+	DWORD misses;		/* Single sector reads that went to the card */
+	DWORD evictions;	/* Lines reused for other sectors */
+	DWORD bypass;		/* Multi sector reads, passed straight through */
+} BlkCacheStats;
+
+void blkcache_init (blkcache_read_fn read);		/* Empty the cache, drop pins and counters */
+DRESULT blkcache_read (BYTE *buff, DWORD sector, UINT count);
+void blkcache_invalidate (DWORD sector, UINT count);	/* Sectors changed on the disk */
+int blkcache_pin (DWORD sector, DWORD count);	/* Keep these sectors: 1:OK, 0:No free slot */
+const BlkCacheStats *blkcache_stats (void);
+
+#endif
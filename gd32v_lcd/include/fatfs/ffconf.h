@@ -8,7 +8,7 @@
 / Function Configurations
 /---------------------------------------------------------------------------*/
 
-#define FF_FS_READONLY	1
+#define FF_FS_READONLY	0
 /* This option switches read-only configuration. (0:Read/Write or 1:Read-only)
 /  Read-only configuration removes writing API functions, f_write(), f_sync(),
 /  f_unlink(), f_mkdir(), f_chmod(), f_rename(), f_truncate(), f_getfree()
@@ -42,14 +42,21 @@
 /* This option switches f_mkfs() function. (0:Disable or 1:Enable) */
 
 
-#define FF_USE_FASTSEEK	0
+#define FF_USE_FASTSEEK	1
 /* This option switches fast seek function. (0:Disable or 1:Enable) */
 
 
-#define FF_USE_EXPAND	0
+#define FF_USE_EXPAND	1
 /* This option switches f_expand function. (0:Disable or 1:Enable) */
 
 
+#define FF_USE_OPENAT	1
+/* This option switches f_open_at() and f_getvsn() functions: open a file read-only
+/  by its start cluster and size, without searching the directory, and get the volume
+/  serial number to check that such data belongs to the mounted volume.
+/  (0:Disable or 1:Enable) FF_FS_LOCK needs to be 0 to enable this option. */
+
+
 #define FF_USE_CHMOD	0
 /* This option switches attribute manipulation functions, f_chmod() and f_utime().
 /  (0:Disable or 1:Enable) Also FF_FS_READONLY needs to be 0 to enable this option. */
@@ -236,10 +243,10 @@
 /  Note that enabling exFAT discards ANSI C (C89) compatibility. */
 
 
-#define FF_FS_NORTC		0
+#define FF_FS_NORTC		1
 #define FF_NORTC_MON	1
 #define FF_NORTC_MDAY	1
-#define FF_NORTC_YEAR	2018
+#define FF_NORTC_YEAR	2020
 /* The option FF_FS_NORTC switches timestamp functiton. If the system does not have
 /  any RTC function or valid timestamp is not needed, set FF_FS_NORTC = 1 to disable
 /  the timestamp function. Every object modified by FatFs will have a fixed timestamp
@@ -262,6 +269,20 @@
 /      lock control is independent of re-entrancy. */
 
 
+#define FF_DIR_INDEX	1024
+#define FF_DIR_INDEX_DIRS	2
+/* The option FF_DIR_INDEX sets the number of entries covered by an in-memory index
+/  of the short file names in a directory (a 1-byte name hash per entry), and
+/  FF_DIR_INDEX_DIRS the number of directories indexed at a time (the least
+/  recently searched one is replaced). A directory is indexed when it is searched
+/  a second time; after that, a lookup there reads only the entries whose hash
+/  matches, about one in 255 besides the one searched for, and so does a name
+/  that is not there. Entries past the first FF_DIR_INDEX of a larger directory
+/  are searched as usual. The indexes follow entries being added and removed,
+/  and are dropped when the volume is mounted again. 0 disables the index. Only
+/  used when FF_USE_LFN is 0. */
+
+
 /* #include <somertos.h>	// O/S definitions */
 #define FF_FS_REENTRANT	0
 #define FF_FS_TIMEOUT	1000
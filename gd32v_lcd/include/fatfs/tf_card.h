@@ -6,4 +6,27 @@
 #include "ff.h"
 #include "systick.h"
 
+int disk_init_step(void);   /* Non-blocking card init: call until it returns 0 */
+void disk_timerproc(void);  /* 1ms timeouts, runs from the systick interrupt */
+void disk_prefetch(void);   /* Keep a sequential read going: call while waiting */
+DWORD disk_spi_clock(void); /* SPI clock chosen at init [Hz] */
+
+#define CT_HS       0x10    /* Card type flag: switched to high-speed mode (CMD6) */
+
+#define SD_CRC      1       /* 1: CRC on commands and data (CMD59), retry bad blocks */
+#define SD_RETRIES  3       /* Repeats of a failed read, the clock steps down on CRC errors */
+
+typedef struct {
+    DWORD crc_data;         /* Data blocks with a bad CRC16 */
+    DWORD crc_cmd;          /* Commands the card rejected for their CRC7 */
+    DWORD retries;          /* Reads repeated */
+    DWORD failed;           /* Reads given up after SD_RETRIES */
+    DWORD slowdowns;        /* SPI clock steps down */
+} SdErrStats;
+
+const SdErrStats *disk_err_stats(void);
+
+#define STRM_SLOTS  4       /* Sectors received ahead of a sequential read */
+#define SD_POLL_BYTES 16    /* Burst size when waiting for the card by DMA */
+
 #endif
@@ -0,0 +1,14 @@
+#ifndef __IDLE_H
+#define __IDLE_H
+
+// Idle: sleep the core (WFI) while waiting for an interrupt - the DMA
+// that feeds the display, or the 1ms tick - and keep book on how much
+// of each second was spent asleep.
+
+#include <stdint.h>
+
+void idle_init(void);               // Starts the per-second bookkeeping (needs systick_init)
+void idle_wait(void);               // Sleep until the next interrupt
+uint16_t idle_permille(void);       // Idle share of the last full second, 0..1000
+
+#endif
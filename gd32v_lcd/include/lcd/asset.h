@@ -0,0 +1,39 @@
+#ifndef __ASSET_H
+#define __ASSET_H
+
+// Compressed image store in flash.
+// Images are packed at build time by tools/assetpack.py into assets_data.h;
+// the ASSET_xxx ids are in assets.h. Pixels are RGB565, RLE-compressed
+// (or raw, if RLE doesn't pay off), and decoded on the fly while they are
+// written to the display - no RAM buffer for the whole image.
+
+#include "lcd/lcd.h"
+#include "lcd/assets.h"
+
+#define ASSET_CODEC_RAW 0   // Pixels as they are, high byte first
+#define ASSET_CODEC_RLE 1   // PackBits-style runs/literals of 16-bit pixels
+
+typedef struct {
+    uint32_t offset;        // Start in the packed data
+    uint32_t size;          // Packed bytes
+    uint16_t width;
+    uint16_t height;
+    uint8_t  codec;
+} Asset;
+
+// Decoder state, for reading an asset piece by piece
+typedef struct {
+    const uint8_t *src;     // Next packed byte
+    const uint8_t *end;
+    uint8_t  codec;
+    uint8_t  left;          // Pixels left in the current run/literal
+    uint8_t  run;           // 1: current block is a run of 'pixel'
+    uint16_t pixel;
+} AssetStream;
+
+const Asset *Asset_Get(u8 id);
+void Asset_Open(AssetStream *s, u8 id);
+u32  Asset_Read(AssetStream *s, uint16_t *dst, u32 n);
+void LCD_ShowAsset(u16 x, u16 y, u8 id);
+
+#endif
@@ -0,0 +1,11 @@
+// Generated by tools/assetpack.py - do not edit.
+
+#ifndef __ASSETS_H
+#define __ASSETS_H
+
+enum {
+	ASSET_LOGO,	// logo.bin, 160x80, 3380 of 25600 bytes
+	ASSET_COUNT
+};
+
+#endif
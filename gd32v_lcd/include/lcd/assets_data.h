@@ -0,0 +1,228 @@
+// Generated by tools/assetpack.py - do not edit.
+// 1 assets, 3380 bytes packed, 25600 bytes unpacked
+
+#ifndef __ASSETS_DATA_H
+#define __ASSETS_DATA_H
+
+#include "lcd/asset.h"
+
+static const uint8_t asset_blob[3380] = {
+	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+	0xFF,0xFF,0xFF,0xE6,0xFF,0xFF,0x01,0xB9,0xFE,0x6F,0xF4,0x88,0x0D,0xF4,0x00,0x2D,
+	0xF4,0x82,0x0D,0xF4,0x00,0x2D,0xF4,0x82,0x0D,0xF4,0x81,0x2D,0xF4,0x02,0x0D,0xF4,
+	0x8F,0xF4,0xFA,0xFE,0xFF,0xFF,0xFF,0x86,0xFF,0xFF,0x01,0xB9,0xFE,0xC7,0xF2,0x81,
+	0xE7,0xEA,0x01,0xE7,0xF2,0x07,0xEB,0x84,0xC7,0xF2,0x87,0xE7,0xF2,0x85,0xC7,0xF2,
+	0x00,0xFA,0xFE,0xFF,0xFF,0xFF,0x85,0xFF,0xFF,0x06,0xED,0xF3,0xE7,0xEA,0xA7,0xF2,
+	0x75,0xFD,0x9A,0xFE,0x4B,0xF3,0xE7,0xEA,0x81,0xC7,0xF2,0x88,0xE7,0xEA,0x00,0xC7,
+	0xEA,0x85,0xC7,0xF2,0x00,0x6F,0xF4,0x8D,0xFF,0xFF,0x00,0x1B,0xFF,0x88,0x58,0xFE,
+	0x00,0x1B,0xFF,0x83,0xFF,0xFF,0x00,0xBE,0xFF,0x83,0x58,0xFE,0x00,0x7D,0xFF,0x89,
+	0xFF,0xFF,0x00,0xB9,0xFE,0x84,0x58,0xFE,0x8F,0xFF,0xFF,0x00,0x99,0xFE,0x88,0x58,
+	0xFE,0x00,0x7D,0xFF,0x89,0xFF,0xFF,0x00,0xDA,0xFE,0x88,0x58,0xFE,0x00,0x3C,0xFF,
+	0x82,0xFF,0xFF,0x00,0xBE,0xFF,0x83,0x58,0xFE,0x01,0xBE,0xFF,0x5C,0xFF,0x85,0x58,
+	0xFE,0x00,0x3C,0xFF,0x91,0xFF,0xFF,0x07,0xAB,0xF3,0xE7,0xEA,0xB6,0xFD,0x7D,0xFF,
+	0x74,0xF5,0xDF,0xFF,0xE8,0xF2,0xC7,0xEA,0x81,0xE7,0xEA,0x00,0x54,0xFD,0x87,0x59,
+	0xFE,0x01,0xCC,0xF3,0xE7,0xEA,0x82,0xC7,0xEA,0x01,0xE7,0xEA,0xED,0xF3,0x8C,0xFF,
+	0xFF,0x00,0x37,0xFE,0x89,0xC7,0xEA,0x00,0x90,0xF4,0x83,0xFF,0xFF,0x00,0xDA,0xFE,
+	0x83,0xC7,0xEA,0x00,0x37,0xFE,0x88,0xFF,0xFF,0x00,0x53,0xF5,0x85,0xC7,0xEA,0x01,
+	0xCC,0xF3,0xBE,0xFF,0x8C,0xFF,0xFF,0x00,0x12,0xF5,0x89,0xC7,0xEA,0x00,0xF6,0xFD,
+	0x88,0xFF,0xFF,0x00,0xB5,0xFD,0x88,0xC7,0xEA,0x01,0xE7,0xEA,0xD1,0xF4,0x82,0xFF,
+	0xFF,0x00,0xFB,0xFE,0x83,0xC7,0xEA,0x02,0xFB,0xFE,0x95,0xFD,0xE7,0xEA,0x85,0xC7,
+	0xEA,0x00,0x99,0xFE,0x90,0xFF,0xFF,0x06,0xEC,0xF3,0xC7,0xEA,0x78,0xFE,0x1B,0xFF,
+	0x0F,0xFC,0xFF,0xFF,0x29,0xEB,0x81,0xE7,0xEA,0x00,0xB7,0xFD,0x88,0xFF,0xFF,0x00,
+	0x8F,0xF4,0x84,0xC7,0xEA,0x00,0x2E,0xF4,0x8B,0xFF,0xFF,0x00,0xB5,0xFD,0x8A,0xC7,
+	0xEA,0x00,0xF2,0xF4,0x83,0xFF,0xFF,0x00,0xFB,0xFE,0x83,0xC7,0xEA,0x00,0x58,0xFE,
+	0x87,0xFF,0xFF,0x00,0xD1,0xF4,0x87,0xC7,0xEA,0x01,0x6A,0xF3,0x5C,0xFF,0x8A,0xFF,
+	0xFF,0x00,0x8F,0xF4,0x8A,0xC7,0xEA,0x00,0x37,0xFE,0x87,0xFF,0xFF,0x00,0x32,0xF5,
+	0x8A,0xC7,0xEA,0x00,0x33,0xFD,0x82,0xFF,0xFF,0x00,0x1B,0xFF,0x83,0xC7,0xEA,0x01,
+	0x1B,0xFF,0xD6,0xFD,0x87,0xC7,0xEA,0x00,0x16,0xFE,0x8F,0xFF,0xFF,0x08,0xCD,0xF3,
+	0xA7,0xEA,0x08,0xEB,0x58,0xFE,0x5C,0xFF,0x2E,0xF4,0xE7,0xEA,0xC7,0xEA,0xF7,0xFD,
+	0x89,0xFF,0xFF,0x01,0x4F,0xF4,0xC7,0xEA,0x82,0xA7,0xEA,0x01,0xC7,0xEA,0x0E,0xF4,
+	0x8A,0xFF,0xFF,0x01,0x12,0xF5,0xC7,0xEA,0x83,0xE8,0xEA,0x82,0xE7,0xEA,0x81,0xE8,
+	0xEA,0x02,0xE7,0xEA,0xE8,0xEA,0xB0,0xF4,0x83,0xFF,0xFF,0x01,0xDA,0xFE,0xE7,0xEA,
+	0x82,0xE8,0xEA,0x00,0x37,0xFE,0x86,0xFF,0xFF,0x04,0x2E,0xF4,0xC7,0xEA,0xE8,0xEA,
+	0xE7,0xEA,0xE8,0xEA,0x83,0xE7,0xEA,0x03,0xE8,0xEA,0xE7,0xEA,0xC8,0xEA,0xFA,0xFE,
+	0x88,0xFF,0xFF,0x00,0x0D,0xF4,0x86,0xE7,0xEA,0x01,0xE8,0xEA,0xE7,0xEA,0x81,0xE8,
+	0xEA,0x01,0xE7,0xEA,0xF6,0xF5,0x86,0xFF,0xFF,0x02,0x90,0xF4,0xC7,0xEA,0xE8,0xEA,
+	0x81,0xE7,0xEA,0x02,0xE8,0xEA,0xE7,0xEA,0xE8,0xEA,0x83,0xE7,0xEA,0x01,0x08,0xEB,
+	0xF1,0xF4,0x82,0xFF,0xFF,0x07,0x1B,0xFF,0xA7,0xEA,0xC7,0xEA,0xA7,0xEA,0xC7,0xEA,
+	0x3C,0xFF,0x95,0xFD,0x08,0xEB,0x82,0xE7,0xEA,0x81,0xE8,0xEA,0x03,0xE7,0xEA,0xE8,
+	0xEA,0xC7,0xEA,0x94,0xFD,0x8E,0xFF,0xFF,0x00,0xCD,0xF3,0x81,0xA7,0xEA,0x81,0xC7,
+	0xEA,0x03,0xC8,0xEA,0xC7,0xEA,0xB6,0xFD,0xFF,0xFF,0x89,0xDF,0xFF,0x01,0x0E,0xF4,
+	0xC7,0xEA,0x82,0xA7,0xEA,0x01,0xC7,0xEA,0x0E,0xF4,0x89,0xFF,0xFF,0x02,0xB0,0xF4,
+	0xC7,0xEA,0x4B,0xF3,0x8A,0xAD,0xF3,0x00,0x95,0xFD,0x83,0xFF,0xFF,0x00,0x3C,0xFF,
+	0x83,0xAD,0xF3,0x00,0xBA,0xFE,0x84,0xFF,0xFF,0x05,0xBE,0xFF,0xCC,0xF3,0xC7,0xEA,
+	0x6C,0xF3,0xAD,0xF3,0xCD,0xF3,0x83,0xAD,0xF3,0x05,0xCD,0xF3,0xAD,0xF3,0xAD,0xFB,
+	0x87,0xEA,0xC7,0xEA,0x58,0xFE,0x85,0xFF,0xFF,0x05,0x9E,0xFF,0x8B,0xF3,0xA7,0xEA,
+	0x8C,0xF3,0xAD,0xF3,0xCD,0xF3,0x84,0xAD,0xF3,0x81,0xCD,0xF3,0x81,0xAD,0xF3,0x00,
+	0x99,0xFE,0x85,0xFF,0xFF,0x04,0x2E,0xF4,0xC7,0xEA,0x6C,0xF3,0xAD,0xF3,0xCD,0xF3,
+	0x88,0xAD,0xF3,0x00,0xD6,0xFD,0x82,0xFF,0xFF,0x00,0x1B,0xFF,0x82,0xA7,0xEA,0x02,
+	0xC7,0xEA,0xDA,0xFE,0x58,0xFE,0x84,0xAD,0xF3,0x05,0xCD,0xF3,0xAD,0xF3,0xAD,0xFB,
+	0xE9,0xF2,0xC7,0xEA,0xF2,0xF4,0x8D,0xFF,0xFF,0x00,0xCD,0xF3,0x82,0xA7,0xEA,0x81,
+	0xC8,0xEA,0x03,0xB7,0xFD,0xFF,0xFF,0xF6,0xFD,0x29,0xEB,0x87,0x09,0xEB,0x01,0x29,
+	0xEB,0xC8,0xEA,0x83,0xA7,0xEA,0x01,0xC8,0xEA,0x0E,0xF4,0x87,0xFF,0xFF,0x04,0xDF,
+	0xFF,0x2E,0xF4,0xA7,0xEA,0xC8,0xEA,0x99,0xFE,0x99,0xFF,0xFF,0x04,0x5C,0xFF,0x4A,
+	0xEB,0xA7,0xEA,0xC8,0xEA,0x5C,0xFF,0x88,0xFF,0xFF,0x00,0x2E,0xF4,0x81,0xA7,0xEA,
+	0x00,0xF6,0xFD,0x83,0xFF,0xFF,0x04,0x3C,0xFF,0x2A,0xEB,0xA7,0xEA,0xC8,0xEA,0xDF,
+	0xFF,0x8F,0xFF,0xFF,0x04,0xBE,0xFF,0xAC,0xF3,0xA7,0xEA,0xC8,0xEA,0x1C,0xFF,0x8E,
+	0xFF,0xFF,0x00,0x1C,0xFF,0x82,0xA7,0xEA,0x01,0xA8,0xEA,0x17,0xFE,0x88,0xFF,0xFF,
+	0x00,0x12,0xF5,0x81,0xA7,0xEA,0x00,0x90,0xF4,0x8C,0xFF,0xFF,0x00,0xCD,0xF3,0x82,
+	0xA8,0xEA,0x01,0xE9,0xEA,0x79,0xFE,0x81,0xFF,0xFF,0x00,0x54,0xFD,0x84,0xA8,0xEA,
+	0x00,0xA7,0xEA,0x81,0xA8,0xEA,0x00,0xA7,0xEA,0x86,0xA8,0xEA,0x00,0x0E,0xF4,0x86,
+	0xFF,0xFF,0x05,0xBE,0xFF,0x2A,0xEB,0xA8,0xEA,0x87,0xEA,0xA8,0xEA,0x58,0xFE,0x98,
+	0xFF,0xFF,0x01,0x1B,0xFF,0xE9,0xEA,0x81,0xA7,0xEA,0x01,0xA8,0xEA,0xFB,0xFE,0x88,
+	0xFF,0xFF,0x04,0x0E,0xF4,0xA8,0xEA,0x88,0xEA,0xC8,0xEA,0x95,0xFD,0x81,0xFF,0xFF,
+	0x01,0xFB,0xFE,0xC8,0xEA,0x82,0xA8,0xEA,0x00,0x7D,0xFF,0x8E,0xFF,0xFF,0x01,0x5C,
+	0xFF,0x2A,0xEB,0x81,0xA8,0xEA,0x01,0x88,0xEA,0xDA,0xFE,0x8E,0xFF,0xFF,0x00,0x1C,
+	0xFF,0x83,0xA8,0xEA,0x00,0x17,0xFE,0x88,0xFF,0xFF,0x01,0xF1,0xF4,0x87,0xEA,0x81,
+	0xA8,0xEA,0x00,0x70,0xF4,0x8B,0xFF,0xFF,0x00,0xCD,0xEB,0x81,0x88,0xEA,0x02,0xA8,
+	0xEA,0xE9,0xEA,0x7D,0xFF,0x81,0xFF,0xFF,0x00,0x75,0xFD,0x85,0xA8,0xEA,0x88,0x88,
+	0xEA,0x01,0xA8,0xEA,0x0E,0xF4,0x86,0xFF,0xFF,0x01,0xDF,0xFF,0xF3,0xFC,0x81,0xA8,
+	0xEA,0x01,0x88,0xEA,0xBA,0xFE,0x98,0xFF,0xFF,0x01,0xD6,0xFD,0xA8,0xEA,0x82,0x88,
+	0xEA,0x00,0xDA,0xFE,0x88,0xFF,0xFF,0x04,0x0E,0xF4,0xA8,0xEA,0xC8,0xE2,0x2B,0xF3,
+	0x7A,0xFE,0x81,0xFF,0xFF,0x05,0x54,0xF5,0xA8,0xEA,0x88,0xEA,0xA8,0xEA,0x88,0xEA,
+	0x5D,0xFF,0x8E,0xFF,0xFF,0x01,0x17,0xFE,0xA8,0xEA,0x82,0x88,0xEA,0x00,0xBA,0xFE,
+	0x8E,0xFF,0xFF,0x00,0x1C,0xFF,0x82,0x88,0xEA,0x01,0xA8,0xEA,0x17,0xFE,0x88,0xFF,
+	0xFF,0x00,0xD1,0xF4,0x82,0x88,0xEA,0x00,0x4B,0xEB,0x8B,0xFF,0xFF,0x00,0xAD,0xEB,
+	0x83,0x88,0xEA,0x03,0xA8,0xEA,0xFB,0xFE,0xFF,0xFF,0x55,0xFD,0x85,0x88,0xEA,0x81,
+	0xA8,0xEA,0x86,0x88,0xEA,0x01,0xA8,0xEA,0xEE,0xF3,0x88,0xFF,0xFF,0x03,0x18,0xFE,
+	0xA8,0xEA,0xA8,0xE2,0x33,0xF5,0x86,0x99,0xFE,0x88,0xFF,0xFF,0x00,0xBE,0xFF,0x83,
+	0x99,0xFE,0x00,0x9E,0xFF,0x82,0xFF,0xFF,0x00,0x17,0xFE,0x83,0x88,0xEA,0x01,0x1B,
+	0xFF,0x3C,0xFF,0x87,0x99,0xFE,0x02,0x8C,0xEB,0xC8,0xE2,0xAD,0xF3,0x83,0xFF,0xFF,
+	0x00,0xB6,0xFD,0x82,0x88,0xEA,0x02,0xA8,0xEA,0x7D,0xFF,0xFB,0xFE,0x89,0x99,0xFE,
+	0x00,0x7D,0xFF,0x82,0xFF,0xFF,0x00,0x59,0xFE,0x83,0x88,0xEA,0x01,0xFB,0xFE,0x3C,
+	0xFF,0x89,0x99,0xFE,0x00,0x5C,0xFF,0x82,0xFF,0xFF,0x00,0x1C,0xFF,0x83,0x88,0xEA,
+	0x00,0x17,0xFE,0x88,0xFF,0xFF,0x00,0xB1,0xF4,0x82,0x88,0xEA,0x00,0xAD,0xEB,0x8B,
+	0xFF,0xFF,0x00,0xAD,0xEB,0x84,0x88,0xEA,0x02,0xA8,0xEA,0xDA,0xFE,0xFF,0xFF,0x85,
+	0xFB,0xFE,0x03,0x96,0xFD,0x88,0xE2,0xA8,0xE2,0x68,0xEA,0x85,0x88,0xEA,0x00,0xEE,
+	0xF3,0x89,0xFF,0xFF,0x02,0xBA,0xFE,0xC9,0xEA,0xA8,0xE2,0x86,0x88,0xEA,0x00,0xEE,
+	0xEB,0x87,0xFF,0xFF,0x00,0xDA,0xFE,0x83,0x88,0xEA,0x00,0x38,0xFE,0x82,0xFF,0xFF,
+	0x00,0x17,0xFE,0x83,0x88,0xEA,0x01,0x7D,0xFF,0x0F,0xF4,0x87,0x88,0xEA,0x01,0xA8,
+	0xE2,0x0F,0xF4,0x84,0xFF,0xFF,0x00,0xB6,0xFD,0x82,0x88,0xEA,0x02,0xC9,0xEA,0x9E,
+	0xFF,0x6C,0xEB,0x89,0x88,0xEA,0x00,0xD6,0xF5,0x82,0xFF,0xFF,0x00,0x59,0xFE,0x83,
+	0x88,0xEA,0x01,0x7D,0xFF,0x91,0xF4,0x89,0x88,0xEA,0x00,0xD2,0xF4,0x82,0xFF,0xFF,
+	0x00,0x1C,0xFF,0x83,0x88,0xEA,0x00,0x17,0xFE,0x88,0xFF,0xFF,0x00,0xB1,0xF4,0x82,
+	0x88,0xEA,0x00,0xAD,0xEB,0x8B,0xFF,0xFF,0x00,0xAD,0xEB,0x85,0x68,0xEA,0x01,0x88,
+	0xE2,0x1B,0xFF,0x86,0xFF,0xFF,0x00,0xF7,0xFD,0x81,0x88,0xE2,0x84,0x68,0xEA,0x01,
+	0x88,0xE2,0xEE,0xF3,0x8A,0xFF,0xFF,0x02,0x1C,0xFF,0xEA,0xEA,0xA8,0xE2,0x86,0x68,
+	0xEA,0x01,0x6C,0xEB,0x9E,0xFF,0x85,0xFF,0xFF,0x00,0xDB,0xFE,0x83,0x68,0xEA,0x00,
+	0x58,0xFE,0x82,0xFF,0xFF,0x01,0x17,0xFE,0x88,0xEA,0x81,0x68,0xEA,0x03,0x88,0xEA,
+	0x7D,0xFF,0x70,0xF4,0x88,0xEA,0x84,0x68,0xEA,0x02,0x88,0xE2,0xA8,0xE2,0x91,0xFC,
+	0x85,0xFF,0xFF,0x07,0xB6,0xFD,0x88,0xEA,0x68,0xEA,0x88,0xEA,0xC9,0xEA,0x9E,0xFF,
+	0xCE,0xF3,0x88,0xEA,0x88,0x68,0xEA,0x00,0x17,0xF6,0x82,0xFF,0xFF,0x01,0x59,0xFE,
+	0x88,0xEA,0x81,0x68,0xEA,0x03,0x88,0xE2,0x7D,0xFF,0xD2,0xF4,0x88,0xE2,0x87,0x68,
+	0xEA,0x01,0x88,0xEA,0x13,0xF5,0x82,0xFF,0xFF,0x00,0x1C,0xFF,0x82,0x68,0xEA,0x01,
+	0x88,0xEA,0x17,0xFE,0x88,0xFF,0xFF,0x00,0xB1,0xF4,0x82,0x68,0xEA,0x00,0xAD,0xEB,
+	0x8B,0xFF,0xFF,0x00,0x8D,0xEB,0x86,0x68,0xEA,0x01,0x88,0xE2,0xFB,0xFE,0x86,0xFF,
+	0xFF,0x02,0x18,0xFE,0x68,0xE2,0x88,0xE2,0x83,0x68,0xEA,0x01,0x68,0xE2,0xEE,0xF3,
+	0x8B,0xFF,0xFF,0x02,0x9E,0xFF,0x4C,0xEB,0xA8,0xE2,0x86,0x88,0xE2,0x01,0xC9,0xEA,
+	0x3C,0xFF,0x84,0xFF,0xFF,0x00,0xFB,0xFE,0x82,0x68,0xEA,0x01,0x68,0xE2,0x58,0xFE,
+	0x82,0xFF,0xFF,0x01,0x18,0xFE,0x68,0xE2,0x81,0x68,0xEA,0x03,0x68,0xE2,0x7D,0xFF,
+	0x0F,0xF4,0xA8,0xE2,0x85,0x88,0xE2,0x00,0x13,0xFD,0x86,0xFF,0xFF,0x06,0xB6,0xF5,
+	0x68,0xE2,0x68,0xEA,0x68,0xE2,0xA9,0xEA,0x9E,0xFF,0x6C,0xEB,0x89,0x88,0xE2,0x00,
+	0xD6,0xF5,0x82,0xFF,0xFF,0x01,0x59,0xFE,0x68,0xE2,0x81,0x68,0xEA,0x03,0x68,0xE2,
+	0x7D,0xFF,0x71,0xF4,0xA8,0xE2,0x87,0x88,0xE2,0x01,0xA8,0xE2,0xB2,0xF4,0x82,0xFF,
+	0xFF,0x00,0x1C,0xFF,0x82,0x68,0xEA,0x01,0x68,0xE2,0x17,0xFE,0x88,0xFF,0xFF,0x00,
+	0xB1,0xF4,0x82,0x68,0xEA,0x00,0x8D,0xEB,0x8B,0xFF,0xFF,0x00,0x8D,0xEB,0x82,0x68,
+	0xE2,0x82,0x68,0xEA,0x82,0x68,0xE2,0x01,0x99,0xFE,0x9E,0xFF,0x84,0x7D,0xFF,0x01,
+	0xFF,0xFF,0xD7,0xFD,0x81,0x68,0xE2,0x00,0x68,0xEA,0x82,0x68,0xE2,0x00,0xEF,0xF3,
+	0x8D,0xFF,0xFF,0x00,0x10,0xF4,0x86,0x4C,0xF3,0x02,0x48,0xEA,0xA9,0xE2,0xDA,0xFE,
+	0x83,0xFF,0xFF,0x00,0xFB,0xFE,0x83,0x68,0xE2,0x00,0x58,0xFE,0x82,0xFF,0xFF,0x00,
+	0x18,0xFE,0x83,0x68,0xE2,0x01,0x5D,0xFF,0x14,0xFD,0x84,0x4C,0xF3,0x01,0x6C,0xEB,
+	0x96,0xFD,0x87,0xFF,0xFF,0x00,0xB6,0xF5,0x82,0x68,0xE2,0x02,0xA9,0xEA,0x9E,0xFF,
+	0x71,0xF4,0x89,0x4C,0xF3,0x00,0x59,0xFE,0x82,0xFF,0xFF,0x00,0x59,0xFE,0x81,0x68,
+	0xE2,0x04,0x68,0xEA,0x68,0xE2,0x3C,0xFF,0x75,0xFD,0x6D,0xF3,0x88,0x4C,0xF3,0x00,
+	0x96,0xFD,0x82,0xFF,0xFF,0x01,0x1C,0xFF,0x68,0xEA,0x82,0x68,0xE2,0x00,0x17,0xFE,
+	0x88,0xFF,0xFF,0x01,0xB2,0xF4,0x68,0xEA,0x81,0x68,0xE2,0x00,0x8D,0xEB,0x8B,0xFF,
+	0xFF,0x00,0x8D,0xEB,0x89,0x48,0xE2,0x85,0x68,0xE2,0x02,0xF7,0xF5,0xFF,0xFF,0xD7,
+	0xFD,0x81,0x68,0xE2,0x81,0x48,0xE2,0x01,0x68,0xE2,0xEF,0xF3,0x95,0xFF,0xFF,0x03,
+	0x0F,0xF4,0x68,0xE2,0x48,0xE2,0x38,0xF6,0x82,0xFF,0xFF,0x02,0xDB,0xFE,0x48,0xE2,
+	0x68,0xE2,0x81,0x48,0xE2,0x00,0x59,0xFE,0x82,0xFF,0xFF,0x01,0x18,0xFE,0x68,0xE2,
+	0x81,0x48,0xE2,0x01,0x68,0xE2,0xDB,0xFE,0x8F,0xFF,0xFF,0x05,0x95,0xF5,0x68,0xE2,
+	0x48,0xE2,0x68,0xE2,0x69,0xE2,0x5D,0xFF,0x8E,0xFF,0xFF,0x01,0x38,0xFE,0x68,0xE2,
+	0x81,0x48,0xE2,0x01,0x68,0xE2,0x9A,0xFE,0x8E,0xFF,0xFF,0x00,0x1C,0xFF,0x81,0x48,
+	0xE2,0x81,0x68,0xE2,0x00,0x17,0xFE,0x88,0xFF,0xFF,0x00,0xB2,0xF4,0x82,0x48,0xE2,
+	0x00,0x8D,0xEB,0x8B,0xFF,0xFF,0x00,0x8D,0xEB,0x8F,0x48,0xE2,0x00,0xB6,0xF5,0x81,
+	0xFF,0xFF,0x01,0x9A,0xFE,0xA9,0xE2,0x81,0x48,0xE2,0x01,0x68,0xE2,0xCF,0xEB,0x95,
+	0xFF,0xFF,0x00,0xEF,0xEB,0x81,0x48,0xE2,0x01,0x69,0xE2,0x96,0xF5,0x81,0xFF,0xFF,
+	0x00,0xDB,0xFE,0x83,0x48,0xE2,0x00,0x59,0xFE,0x82,0xFF,0xFF,0x00,0x18,0xFE,0x83,
+	0x48,0xE2,0x00,0xDB,0xFE,0x8F,0xFF,0xFF,0x01,0x96,0xF5,0x69,0xE2,0x81,0x48,0xE2,
+	0x01,0x69,0xE2,0x5D,0xFF,0x8E,0xFF,0xFF,0x01,0x59,0xFE,0x69,0xE2,0x82,0x48,0xE2,
+	0x00,0xBA,0xFE,0x8E,0xFF,0xFF,0x00,0x1C,0xFF,0x83,0x48,0xE2,0x00,0x17,0xFE,0x88,
+	0xFF,0xFF,0x00,0x92,0xF4,0x82,0x48,0xE2,0x00,0x0B,0xE3,0x8B,0xFF,0xFF,0x00,0x6D,
+	0xEB,0x85,0x48,0xE2,0x88,0x49,0xE2,0x01,0x69,0xE2,0x96,0xF5,0x81,0xFF,0xFF,0x01,
+	0xBA,0xFE,0x69,0xE2,0x82,0x48,0xE2,0x00,0xCF,0xEB,0x95,0xFF,0xFF,0x04,0x10,0xF4,
+	0x48,0xE2,0x69,0xDA,0x89,0xEA,0x18,0xFE,0x81,0xFF,0xFF,0x00,0xDB,0xFE,0x83,0x48,
+	0xE2,0x00,0x59,0xFE,0x82,0xFF,0xFF,0x00,0x18,0xFE,0x83,0x48,0xE2,0x00,0xDB,0xFE,
+	0x8F,0xFF,0xFF,0x04,0xBE,0xFF,0xCF,0xF3,0x69,0xDA,0x48,0xE2,0x49,0xE2,0x8F,0xFF,
+	0xFF,0x05,0xDF,0xFF,0x92,0xFC,0x69,0xE2,0x49,0xE2,0x48,0xE2,0x3C,0xFF,0x8E,0xFF,
+	0xFF,0x00,0x1C,0xFF,0x83,0x48,0xE2,0x00,0xF7,0xFD,0x88,0xFF,0xFF,0x01,0xD3,0xF4,
+	0x48,0xE2,0x81,0x49,0xE2,0x00,0x96,0xFD,0x8B,0xFF,0xFF,0x00,0x6D,0xEB,0x83,0x28,
+	0xE2,0x81,0x49,0xE2,0x00,0x49,0xEA,0x81,0x69,0xE2,0x01,0x49,0xE2,0x49,0xEA,0x82,
+	0x49,0xE2,0x0A,0x69,0xEA,0x69,0xE2,0xD7,0xFD,0xFF,0xFF,0x18,0xF6,0x49,0xE2,0x48,
+	0xE2,0x28,0xE2,0x48,0xE2,0x49,0xE2,0xCF,0xEB,0x89,0xFF,0xFF,0x8B,0x3C,0xFF,0x03,
+	0x8E,0xEB,0x69,0xDA,0x0C,0xEB,0x7D,0xFF,0x82,0xFF,0xFF,0x00,0xDB,0xFE,0x83,0x28,
+	0xE2,0x00,0x59,0xFE,0x82,0xFF,0xFF,0x01,0x18,0xFE,0x49,0xE2,0x82,0x28,0xE2,0x00,
+	0xDB,0xFE,0x91,0xFF,0xFF,0x03,0x71,0xF4,0x69,0xDA,0x28,0xE2,0xBA,0xFE,0x8A,0x3C,
+	0xFF,0x00,0xBE,0xFF,0x84,0xFF,0xFF,0x00,0x14,0xFD,0x81,0x49,0xE2,0x00,0x18,0xF6,
+	0x8A,0x3C,0xFF,0x00,0x9E,0xFF,0x82,0xFF,0xFF,0x00,0x1C,0xFF,0x82,0x28,0xE2,0x02,
+	0x48,0xE2,0x38,0xFE,0xBE,0xFF,0x87,0x3C,0xFF,0x00,0x30,0xEC,0x81,0x49,0xE2,0x00,
+	0x18,0xFE,0x8C,0xFF,0xFF,0x00,0x6D,0xEB,0x83,0x28,0xE2,0x03,0x49,0xE2,0xEF,0xEB,
+	0x9E,0xFF,0x7E,0xFF,0x85,0x9E,0xFF,0x04,0x7E,0xFF,0x9E,0xFF,0xFF,0xFF,0xF7,0xF5,
+	0x29,0xE2,0x83,0x28,0xE2,0x01,0x49,0xE2,0xCF,0xEB,0x88,0xFF,0xFF,0x02,0xDF,0xFF,
+	0x69,0xE2,0x29,0xE2,0x81,0x28,0xE2,0x00,0x29,0xE2,0x81,0x28,0xE2,0x00,0x29,0xE2,
+	0x82,0x28,0xE2,0x03,0x29,0xE2,0x49,0xDA,0x6E,0xF3,0xDF,0xFF,0x83,0xFF,0xFF,0x01,
+	0xDB,0xFE,0x28,0xE2,0x82,0x29,0xE2,0x00,0x59,0xFE,0x82,0xFF,0xFF,0x05,0x18,0xFE,
+	0x29,0xE2,0x28,0xE2,0x29,0xE2,0x28,0xE2,0xDB,0xFE,0x92,0xFF,0xFF,0x02,0xF3,0xFC,
+	0x49,0xDA,0x49,0xE2,0x86,0x28,0xE2,0x00,0x29,0xE2,0x82,0x28,0xE2,0x00,0xF7,0xF5,
+	0x85,0xFF,0xFF,0x00,0x96,0xFD,0x81,0x49,0xE2,0x01,0x28,0xE2,0x29,0xE2,0x84,0x28,
+	0xE2,0x00,0x29,0xE2,0x81,0x28,0xE2,0x01,0x29,0xE2,0xF3,0xF4,0x82,0xFF,0xFF,0x07,
+	0x1C,0xFF,0x28,0xE2,0x29,0xE2,0x28,0xE2,0x29,0xE2,0xFB,0xFE,0xB6,0xF5,0x29,0xE2,
+	0x86,0x28,0xE2,0x02,0x49,0xDA,0x6A,0xE2,0x9A,0xFE,0x8D,0xFF,0xFF,0x00,0x6D,0xEB,
+	0x84,0x29,0xE2,0x00,0x51,0xEC,0x89,0xFF,0xFF,0x00,0x38,0xF6,0x86,0x29,0xE2,0x00,
+	0xCF,0xEB,0x88,0xFF,0xFF,0x01,0xDF,0xFF,0x49,0xE2,0x89,0x29,0xE2,0x01,0x49,0xDA,
+	0xF0,0xF3,0x85,0xFF,0xFF,0x00,0xDB,0xFE,0x83,0x29,0xE2,0x00,0x39,0xFE,0x82,0xFF,
+	0xFF,0x00,0x18,0xFE,0x83,0x29,0xE2,0x00,0xDB,0xFE,0x93,0xFF,0xFF,0x00,0x96,0xFD,
+	0x81,0x49,0xDA,0x89,0x29,0xE2,0x00,0xF7,0xF5,0x86,0xFF,0xFF,0x02,0x38,0xFE,0x29,
+	0xE2,0x49,0xDA,0x89,0x29,0xE2,0x00,0xD3,0xF4,0x82,0xFF,0xFF,0x00,0x1C,0xFF,0x83,
+	0x29,0xE2,0x01,0xFC,0xFE,0x96,0xF5,0x86,0x29,0xE2,0x02,0x49,0xDA,0xAB,0xEA,0x3C,
+	0xFF,0x8E,0xFF,0xFF,0x00,0x6E,0xEB,0x84,0x29,0xE2,0x00,0x51,0xF4,0x88,0xFF,0xFF,
+	0x00,0x18,0xF6,0x87,0x29,0xE2,0x00,0xAF,0xEB,0x88,0xFF,0xFF,0x01,0xBE,0xFF,0x29,
+	0xE2,0x88,0x29,0xDA,0x01,0x49,0xDA,0x72,0xF4,0x86,0xFF,0xFF,0x00,0xBB,0xFE,0x83,
+	0x29,0xDA,0x00,0x18,0xF6,0x82,0xFF,0xFF,0x00,0xD7,0xF5,0x83,0x29,0xDA,0x00,0xBA,
+	0xFE,0x94,0xFF,0xFF,0x02,0x18,0xFE,0x29,0xE2,0x49,0xDA,0x88,0x29,0xDA,0x00,0xB7,
+	0xF5,0x87,0xFF,0xFF,0x02,0xBA,0xFE,0x6A,0xE2,0x49,0xDA,0x88,0x29,0xDA,0x00,0xB2,
+	0xF4,0x82,0xFF,0xFF,0x00,0xFB,0xFE,0x83,0x29,0xDA,0x02,0xDB,0xFE,0x76,0xF5,0x49,
+	0xDA,0x84,0x29,0xDA,0x02,0x49,0xDA,0x2D,0xEB,0x9E,0xFF,0x8F,0xFF,0xFF,0x00,0x2D,
+	0xE3,0x84,0x09,0xE2,0x01,0xAF,0xEB,0xDB,0xFE,0x85,0xBB,0xFE,0x01,0xDB,0xFE,0x96,
+	0xF5,0x87,0x09,0xE2,0x01,0x29,0xE2,0x8E,0xEB,0x88,0xFF,0xFF,0x02,0xDF,0xFF,0x2D,
+	0xEB,0xCB,0xEA,0x85,0xCC,0xEA,0x02,0xCB,0xEA,0xEC,0xEA,0x14,0xFD,0x87,0xFF,0xFF,
+	0x00,0xFC,0xFE,0x82,0xCC,0xEA,0x01,0xCB,0xEA,0x7A,0xFE,0x82,0xFF,0xFF,0x01,0x39,
+	0xFE,0xCB,0xEA,0x81,0xCC,0xEA,0x01,0xCB,0xEA,0xFB,0xFE,0x95,0xFF,0xFF,0x02,0x9A,
+	0xFE,0x2D,0xEB,0xCB,0xEA,0x86,0xCC,0xEA,0x01,0xCB,0xEA,0x39,0xFE,0x88,0xFF,0xFF,
+	0x02,0x3C,0xFF,0x6E,0xEB,0xCC,0xEA,0x86,0xEC,0xEA,0x01,0xCC,0xEA,0x55,0xF5,0x82,
+	0xFF,0xFF,0x00,0x3C,0xFF,0x83,0xEC,0xEA,0x02,0x1C,0xFF,0x18,0xFE,0xCC,0xEA,0x83,
+	0xEC,0xEA,0x01,0xCC,0xEA,0xF0,0xF3,0x91,0xFF,0xFF,0x01,0x4D,0xEB,0x29,0xDA,0x95,
+	0x09,0xE2,0x01,0x29,0xDA,0xAF,0xF3,0xFF,0xFF,0xFF,0x85,0xFF,0xFF,0x00,0x18,0xFE,
+	0x81,0x29,0xDA,0x01,0x09,0xE2,0x09,0xDA,0x81,0x09,0xE2,0x83,0x09,0xDA,0x01,0x09,
+	0xE2,0x09,0xDA,0x81,0x09,0xE2,0x83,0x09,0xDA,0x00,0x09,0xE2,0x81,0x09,0xDA,0x03,
+	0x09,0xE2,0x29,0xDA,0x09,0xDA,0x79,0xFE,0xFF,0xFF,0xFF,0x86,0xFF,0xFF,0x01,0xF8,
+	0xFD,0xCF,0xEB,0x93,0x6E,0xEB,0x01,0xD0,0xEB,0x39,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,
+	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+	0xFF,0xE0,0xFF,0xFF,
+};
+
+static const Asset asset_table[ASSET_COUNT] = {
+	{      0,   3380, 160,  80, ASSET_CODEC_RLE },	// ASSET_LOGO
+};
+
+#endif
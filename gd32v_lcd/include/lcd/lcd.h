@@ -9,19 +9,46 @@
                             // 0 or 1 for Portrait Mode
                             // 2 or 3 for Landscape Mode
 #define HAS_BLK_CNTL    0   // No Block Mode with this display
+#define LCD_ROTATE      0   // 1: orientation can be changed at runtime
+                            // (LCD_W/LCD_H are then read from a descriptor)
 
-#if USE_HORIZONTAL==0||USE_HORIZONTAL==1    //
-#define LCD_W 80
-#define LCD_H 160
+#define LCD_PANEL_LONGAN    0   // 0.96" 80x160 ST7735S of the Longan Nano
+#define LCD_PANEL_ST7735R   1   // 1.8" 128x160 ST7735R modules
+#define LCD_PANEL LCD_PANEL_LONGAN  // Profiles are in lcd/lcd_panel.h
+
+#if LCD_PANEL == LCD_PANEL_ST7735R
+#define LCD_PANEL_W 128     // Portrait size
+#define LCD_PANEL_H 160
 #else
-#define LCD_W 160
-#define LCD_H 80
+#define LCD_PANEL_W 80
+#define LCD_PANEL_H 160
 #endif
 
 typedef unsigned char u8;
 typedef unsigned int u16;
 typedef unsigned long u32;    			
 
+// Orientation descriptor: one per USE_HORIZONTAL value, see lcd.c
+typedef struct {
+    uint8_t madctl;         // MADCTL (0x36): scan direction and RGB order
+    uint8_t xoff, yoff;     // Visible area in the controller's 162x132 RAM
+    uint8_t width, height;
+} LCD_Orientation;
+
+#define LCD_MAX_DIM LCD_PANEL_H   // Longer side: for buffers that fit any orientation
+
+#if LCD_ROTATE
+extern const LCD_Orientation *lcd_orient;
+#define LCD_W (lcd_orient->width)
+#define LCD_H (lcd_orient->height)
+#elif USE_HORIZONTAL==0||USE_HORIZONTAL==1    //
+#define LCD_W LCD_PANEL_W
+#define LCD_H LCD_PANEL_H
+#else
+#define LCD_W LCD_PANEL_H
+#define LCD_H LCD_PANEL_W
+#endif
+
 
 // #define LED_ON gpio_bit_reset(GPIOC,GPIO_PIN_13)
 // #define LED_OFF gpio_bit_set(GPIOC,GPIO_PIN_13)
@@ -29,10 +56,12 @@ typedef unsigned long u32;
 #define LED_ON 
 #define LED_OFF 
 
-#define SPI0_CFG 1  //hardware spi
-// #define SPI0_CFG 2  //hardware spi dma
+// #define SPI0_CFG 1  //hardware spi
+#define SPI0_CFG 2  //hardware spi, pixel data by dma through the command queue
 // #define SPI0_CFG 3  //software spi
 
+#define LCD_BUS_BENCH 0     // 1: build LCD_Bus_Bench() to time the bus (hardware spi)
+
 #define FRAME_SIZE  25600
 
 //-----------------OLED Port definition---------------- 
@@ -52,8 +81,8 @@ typedef unsigned long u32;
 #define OLED_SDIN_Clr()
 #define OLED_SDIN_Set()
 
-#define OLED_CS_Clr()
-#define OLED_CS_Set()
+#define OLED_CS_Clr() gpio_bit_reset(GPIOB,GPIO_PIN_2)     //CS PB2
+#define OLED_CS_Set() gpio_bit_set(GPIOB,GPIO_PIN_2)
 #else /* SPI0_CFG */
 #define OLED_SCLK_Clr() gpio_bit_reset(GPIOA,GPIO_PIN_5)    //CLK PA5
 #define OLED_SCLK_Set() gpio_bit_set(GPIOA,GPIO_PIN_5)
@@ -86,12 +115,36 @@ typedef unsigned long u32;
 extern  u16 BACK_COLOR;                 //Background color is global
 extern unsigned char image[12800];      //Buffer memory
 
-void LCD_Writ_Bus(u8 dat);
+// Bus transactions: CS is held from Begin to End, no per-byte handshake.
+// LCD_Address_Set opens one; draw the pixels, then call LCD_Bus_End().
+void LCD_Bus_Begin(void);
+void LCD_Bus_Cmd(u8 cmd);
+void LCD_Bus_Write8(u8 dat);
+void LCD_Bus_Write16(u16 dat);      // Pixel: 16-bit SPI frame with hardware spi
+void LCD_Bus_WriteN(const u8 *buf, u32 n);
+void LCD_Bus_Fill(u16 color, u32 n);
+void LCD_Bus_End(void);
+
+// Address window cache: LCD_Address_Set only sends CASET/RASET if they changed
+typedef struct {
+    u32 windows;                    // LCD_Address_Set calls (and queued windows)
+    u32 caset, raset;               // Commands sent
+    u32 saved;                      // Commands skipped
+} LCD_WindowStats;
+void LCD_Window_Invalidate(void);   // After talking to the display directly
+const LCD_WindowStats *LCD_Window_Stats(void);
+#if LCD_BUS_BENCH
+void LCD_Bus_Bench(u32 *per_byte, u32 *burst);
+#endif
+
+void LCD_Writ_Bus(u8 dat);          // Single byte in its own transaction
 void LCD_WR_DATA8(u8 dat);
 void LCD_WR_DATA(u16 dat);
 void LCD_WR_REG(u8 dat);
 void LCD_Address_Set(u16 x1,u16 y1,u16 x2,u16 y2);
 void Lcd_Init(void);
+int Lcd_Init_Step(void);            // Non-blocking init: call until it returns 0
+void LCD_SetOrientation(u8 o);      // 0..3 like USE_HORIZONTAL; needs LCD_ROTATE
 void LCD_Clear(u16 Color);
 // void LCD_ShowChinese(u16 x,u16 y,u8 index,u8 size,u16 color); Sorry!
 void LCD_DrawPoint(u16 x,u16 y,u16 color);
@@ -108,6 +161,24 @@ void LCD_ShowNum1(u16 x,u16 y,float num,u8 len,u16 color);
 void LCD_ShowPicture(u16 x1,u16 y1,u16 x2,u16 y2);
 void LCD_ShowLogo(void);
 
+// Command queue
+// With SPI0_CFG == 2, LCD_Fill, LCD_Clear, LCD_ShowPicture, LCD_QueuePicture
+// and LCD_QueuePixels
+// only put a (window, data source, length) descriptor into a ring buffer and
+// return; the DMA-complete interrupt sends one descriptor after the other.
+// Buffers handed over must stay untouched until the queue is past them.
+// All other drawing calls wait for the queue to run empty first.
+// With the other SPI0_CFG settings the same calls simply draw right away.
+#define LCDQ_SIZE   8               // Descriptors in the ring
+#define LCDQ_BYTES  0               // Data source: byte buffer, high byte first
+#define LCDQ_FILL   1               // Data source: one color, repeated
+#define LCDQ_PIXELS 2               // Data source: uint16_t pixels, 16-bit DMA
+#define LCDQ_PIXELS32 3             // Data source: u16 (32-bit) pixels
+void LCD_QueuePicture(u16 x1,u16 y1,u16 x2,u16 y2,const u8 *buf);
+void LCD_QueuePixels(u16 x1,u16 y1,u16 x2,u16 y2,const uint16_t *buf);
+void LCD_Sync(void);                // Wait until everything queued is on the display
+u8 LCD_Pending(void);               // Descriptors not yet finished
+
 // added functions
 void LCD_drawBitmap(u16 *b, u8 x1, u8 y1, u8 Width, u8 Height);
 void LCD_ShowStringX(u16 x,u16 y,const u8 *p,u16 color, u8 fontsize);
@@ -117,6 +188,22 @@ void LCD_ShowNum1X(u16 x,u16 y,float num,u8 len,u16 color,u8 fontsize);
 void LCD_printChar(u16 x,u16 y,u8 c,u16 color,u8 fontsize);
 u16 dampenColor(u16 color);
 
+// Color blending
+// LCD_Lerp565 mixes two RGB565 colors, alpha 0 (=bg) to 32 (=fg).
+// All three channels are spread out into one 32-bit word (0x07E0F81F:
+// G on top, R and B below with gaps), so one multiply blends them at once
+// and nothing spills from one channel into the next.
+static inline u16 LCD_Lerp565(u16 bg, u16 fg, u8 alpha)
+{
+    uint32_t b = (bg | ((uint32_t)bg << 16)) & 0x07E0F81F;
+    uint32_t f = (fg | ((uint32_t)fg << 16)) & 0x07E0F81F;
+    uint32_t r = (b + (((f - b) * alpha) >> 5)) & 0x07E0F81F;
+    return (u16)(r | (r >> 16));
+}
+// 16-step fg-to-bg table for 4-bit coverage values, cached per (fg,bg) pair
+#define BLEND_CACHE 4
+const uint16_t *LCD_BlendLUT(u16 fg, u16 bg);
+
 // Buffer for scale2x, scale3x and printChar routines
 #define X_BUF 24
 #define Y_BUF 48
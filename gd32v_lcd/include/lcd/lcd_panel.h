@@ -0,0 +1,105 @@
+#ifndef __LCD_PANEL_H
+#define __LCD_PANEL_H
+
+// Panel profiles: init sequence and orientation table, as pure data.
+// Only included by lcd.c; pick the panel with LCD_PANEL in lcd.h.
+//
+// Init sequences are byte-coded, one command after the other:
+//   command, count, count parameter bytes [, delay in ms]
+// If LCD_SEQ_DELAY is set in the count byte, a delay byte follows the
+// parameters. Each command goes out with its parameters in one CS burst.
+// The list ends with LCD_SEQ_END (the NOP command is never needed).
+// MADCTL is not in the list: it comes from the orientation table and
+// goes out right before Display On (0x29), or at the end if there is none.
+//
+// The delays are the datasheet minimums: after Sleep Out (0x11) the
+// controller needs 5ms before the next command.
+
+#include "lcd/lcd.h"
+
+#define LCD_SEQ_DELAY   0x80    // Count flag: a delay byte follows
+#define LCD_SEQ_END     0x00
+
+typedef struct {
+    const uint8_t *init;            // Init sequence, see above
+    LCD_Orientation orient[4];      // Indexed like USE_HORIZONTAL
+} LCD_Panel;
+
+
+#if LCD_PANEL == LCD_PANEL_LONGAN
+// 0.96" 80x160 IPS panel of the Longan Nano (ST7735S)
+static const uint8_t lcd_init_longan[] = {
+    0x11, LCD_SEQ_DELAY|0, 5,               // Sleep out
+    0x21, 0,                                // Display inversion on: this panel needs it
+    0xB1, 3, 0x05, 0x3A, 0x3A,              // Frame rate, normal mode: RTNA, FPA, BPA
+                                            // Frame rate=fosc/((RTNA x 2 + 40) x (LINE + FPA + BPA +2))
+                                            // fosc = 850kHz
+    0xB2, 3, 0x05, 0x3A, 0x3A,              // Frame rate, idle mode: RTNB, FPB, BPB
+    0xB3, 6, 0x05, 0x3A, 0x3A,              // Frame rate, partial mode: dot inversion...
+             0x05, 0x3A, 0x3A,              // ...and column inversion
+    0xB4, 1, 0x03,                          // Display inversion control
+    0xC0, 3, 0x62, 0x02, 0x04,              // Power control 1..5
+    0xC1, 1, 0xC0,
+    0xC2, 2, 0x0D, 0x00,
+    0xC3, 2, 0x8D, 0x6A,
+    0xC4, 2, 0x8D, 0xEE,
+    0xC5, 1, 0x0E,                          // VCOM
+    0xE0, 16, 0x10, 0x0E, 0x02, 0x03, 0x0E, 0x07, 0x02, 0x07,   // Gamma +
+              0x0A, 0x12, 0x27, 0x37, 0x00, 0x0D, 0x0E, 0x10,
+    0xE1, 16, 0x10, 0x0E, 0x03, 0x03, 0x0F, 0x06, 0x02, 0x08,   // Gamma -
+              0x0A, 0x13, 0x26, 0x36, 0x00, 0x0D, 0x0E, 0x10,
+    0x3A, 1, 0x05,                          // 16 bits per pixel
+    0x29, 0,                                // Display on
+    LCD_SEQ_END
+};
+
+static const LCD_Panel lcd_panel_longan = {
+    lcd_init_longan,
+    {   // The 80x160 pixels sit in the middle of the 132x162 controller RAM
+        { 0x08, 26,  1,  80, 160 },         // 0: portrait
+        { 0xC8, 26,  1,  80, 160 },         // 1: portrait, upside down
+        { 0x78,  1, 26, 160,  80 },         // 2: landscape - THIS IS WHAT WE ARE USING
+        { 0xA8,  1, 26, 160,  80 },         // 3: landscape, upside down
+    }
+};
+#endif
+
+
+#if LCD_PANEL == LCD_PANEL_ST7735R
+// 1.8" 128x160 TN panel (ST7735R, "red tab" modules)
+static const uint8_t lcd_init_st7735r[] = {
+    0x11, LCD_SEQ_DELAY|0, 5,               // Sleep out
+    0xB1, 3, 0x01, 0x2C, 0x2D,              // Frame rate, normal mode
+    0xB2, 3, 0x01, 0x2C, 0x2D,              // Frame rate, idle mode
+    0xB3, 6, 0x01, 0x2C, 0x2D,              // Frame rate, partial mode
+             0x01, 0x2C, 0x2D,
+    0xB4, 1, 0x07,                          // No inversion
+    0xC0, 3, 0xA2, 0x02, 0x84,              // Power control 1..5
+    0xC1, 1, 0xC5,
+    0xC2, 2, 0x0A, 0x00,
+    0xC3, 2, 0x8A, 0x2A,
+    0xC4, 2, 0x8A, 0xEE,
+    0xC5, 1, 0x0E,                          // VCOM
+    0x20, 0,                                // Display inversion off
+    0xE0, 16, 0x02, 0x1C, 0x07, 0x12, 0x37, 0x32, 0x29, 0x2D,   // Gamma +
+              0x29, 0x25, 0x2B, 0x39, 0x00, 0x01, 0x03, 0x10,
+    0xE1, 16, 0x03, 0x1D, 0x07, 0x06, 0x2E, 0x2C, 0x29, 0x2D,   // Gamma -
+              0x2E, 0x2E, 0x37, 0x3F, 0x00, 0x00, 0x02, 0x10,
+    0x3A, 1, 0x05,                          // 16 bits per pixel
+    0x13, 0,                                // Normal display mode
+    0x29, 0,                                // Display on
+    LCD_SEQ_END
+};
+
+static const LCD_Panel lcd_panel_st7735r = {
+    lcd_init_st7735r,
+    {   // Panel fills the controller RAM (GM=11): no offsets
+        { 0xC8,  0,  0, 128, 160 },         // 0: portrait
+        { 0x08,  0,  0, 128, 160 },         // 1: portrait, upside down
+        { 0xA8,  0,  0, 160, 128 },         // 2: landscape
+        { 0x68,  0,  0, 160, 128 },         // 3: landscape, upside down
+    }
+};
+#endif
+
+#endif
@@ -0,0 +1,50 @@
+#ifndef __PFONT_H
+#define __PFONT_H
+
+// Packed proportional fonts.
+// Glyph bitmaps are stored column by column with the LSB on top, like the
+// BasicFont, but every glyph only keeps the columns that carry ink.
+// The fonts are compiled from BDF files by tools/bdf2pfont.py.
+// Anti-aliased fonts hold 2 or 4 bits of coverage per pixel instead of one
+// bit; they are drawn through LCD_BlendLUT.
+
+#include "lcd/lcd.h"
+
+#define PFONT_MAX_HEIGHT    16                      // Rows per glyph
+#define PFONT_MAX_BPP       4                       // Bits per pixel
+#define PFONT_COL_BYTES     ((PFONT_MAX_HEIGHT*PFONT_MAX_BPP+7)/8)
+
+typedef struct {
+    uint16_t offset;        // First byte of the glyph in the bitmap table
+    uint8_t  width;         // Bitmap columns
+    uint8_t  advance;       // Pen advance in pixels
+    int8_t   xoff;          // Bitmap start relative to the pen
+} PFontGlyph;
+
+typedef struct {
+    uint8_t  left;          // Character pair...
+    uint8_t  right;
+    int8_t   adjust;        // ...and the pixels to add to the advance
+} PFontKern;
+
+typedef struct {
+    const uint8_t    *bitmap;   // Column bytes, (height*bpp+7)/8 per column
+    const PFontGlyph *glyph;    // One entry per character, first..last
+    const PFontKern  *kern;     // Sorted by left, then right; may be 0
+    uint16_t nkern;
+    uint8_t  first;             // First and last character in the font
+    uint8_t  last;
+    uint8_t  height;            // Rows per column
+    uint8_t  baseline;          // Rows above the baseline
+    uint8_t  bpp;               // 1, or 2/4 for anti-aliased fonts
+} PFont;
+
+// Fonts in flash
+extern const PFont PFont_Prop8;     // 8px, compiled from the BasicFont
+extern const PFont PFont_Prop16;    // 16px, compiled from the 8x16 ASCII font
+extern const PFont PFont_Prop8AA;   // 8px, 4bpp, the 16px font shrunk by 2
+
+u16 PFont_TextWidth(const PFont *f, const u8 *p);
+u16 LCD_ShowStringP(u16 x,u16 y,const u8 *p,u16 color,const PFont *f);
+
+#endif
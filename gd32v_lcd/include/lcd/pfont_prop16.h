@@ -0,0 +1,245 @@
+// Generated by tools/bdf2pfont.py from prop16.bdf - do not edit.
+// 95 glyphs (0x20-0x7E), 16 px high, 1 bpp, 1160 bitmap bytes, 27 kerning pairs
+
+#ifndef __PFONT_PROP16_H
+#define __PFONT_PROP16_H
+
+#include "lcd/pfont.h"
+
+static const uint8_t PFont_Prop16_bitmap[1160] = {
+	0xF8,0x33,0x00,0x30,	// 0x21
+	0x10,0x00,0x0C,0x00,0x06,0x00,0x10,0x00,0x0C,0x00,0x06,0x00,	// 0x22
+	0x40,0x04,0xC0,0x3F,0x78,0x04,0x40,0x04,0xC0,0x3F,0x78,0x04,0x40,0x04,	// 0x23
+	0x70,0x18,0x88,0x20,0xFC,0xFF,0x08,0x21,0x30,0x1E,	// 0x24
+	0xF0,0x00,0x08,0x21,0xF0,0x1C,0x00,0x03,0xE0,0x1E,0x18,0x21,0x00,0x1E,	// 0x25
+	0x00,0x1E,0xF0,0x21,0x08,0x23,0x88,0x24,0x70,0x19,0x00,0x27,0x00,0x21,0x00,0x10,	// 0x26
+	0x10,0x00,0x16,0x00,0x0E,0x00,	// 0x27
+	0xE0,0x07,0x18,0x18,0x04,0x20,0x02,0x40,	// 0x28
+	0x02,0x40,0x04,0x20,0x18,0x18,0xE0,0x07,	// 0x29
+	0x40,0x02,0x40,0x02,0x80,0x01,0xF0,0x0F,0x80,0x01,0x40,0x02,0x40,0x02,	// 0x2A
+	0x00,0x01,0x00,0x01,0x00,0x01,0xF0,0x1F,0x00,0x01,0x00,0x01,0x00,0x01,	// 0x2B
+	0x00,0x80,0x00,0xB0,0x00,0x70,	// 0x2C
+	0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,	// 0x2D
+	0x00,0x30,0x00,0x30,	// 0x2E
+	0x00,0x60,0x00,0x18,0x00,0x06,0x80,0x01,0x60,0x00,0x18,0x00,0x04,0x00,	// 0x2F
+	0xE0,0x0F,0x10,0x10,0x08,0x20,0x08,0x20,0x10,0x10,0xE0,0x0F,	// 0x30
+	0x10,0x20,0x10,0x20,0xF8,0x3F,0x00,0x20,0x00,0x20,	// 0x31
+	0x70,0x30,0x08,0x28,0x08,0x24,0x08,0x22,0x88,0x21,0x70,0x30,	// 0x32
+	0x30,0x18,0x08,0x20,0x88,0x20,0x88,0x20,0x48,0x11,0x30,0x0E,	// 0x33
+	0x00,0x07,0xC0,0x04,0x20,0x24,0x10,0x24,0xF8,0x3F,0x00,0x24,	// 0x34
+	0xF8,0x19,0x08,0x21,0x88,0x20,0x88,0x20,0x08,0x11,0x08,0x0E,	// 0x35
+	0xE0,0x0F,0x10,0x11,0x88,0x20,0x88,0x20,0x18,0x11,0x00,0x0E,	// 0x36
+	0x38,0x00,0x08,0x00,0x08,0x3F,0xC8,0x00,0x38,0x00,0x08,0x00,	// 0x37
+	0x70,0x1C,0x88,0x22,0x08,0x21,0x08,0x21,0x88,0x22,0x70,0x1C,	// 0x38
+	0xE0,0x00,0x10,0x31,0x08,0x22,0x08,0x22,0x10,0x11,0xE0,0x0F,	// 0x39
+	0xC0,0x30,0xC0,0x30,	// 0x3A
+	0x00,0x80,0x80,0x60,	// 0x3B
+	0x00,0x01,0x80,0x02,0x40,0x04,0x20,0x08,0x10,0x10,0x08,0x20,	// 0x3C
+	0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,0x40,0x04,	// 0x3D
+	0x08,0x20,0x10,0x10,0x20,0x08,0x40,0x04,0x80,0x02,0x00,0x01,	// 0x3E
+	0x70,0x00,0x48,0x00,0x08,0x30,0x08,0x36,0x08,0x01,0xF0,0x00,	// 0x3F
+	0xC0,0x07,0x30,0x18,0xC8,0x27,0x28,0x24,0xE8,0x23,0x10,0x14,0xE0,0x0B,	// 0x40
+	0x00,0x20,0x00,0x3C,0xC0,0x23,0x38,0x02,0xE0,0x02,0x00,0x27,0x00,0x38,0x00,0x20,	// 0x41
+	0x08,0x20,0xF8,0x3F,0x88,0x20,0x88,0x20,0x88,0x20,0x70,0x11,0x00,0x0E,	// 0x42
+	0xC0,0x07,0x30,0x18,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x10,0x38,0x08,	// 0x43
+	0x08,0x20,0xF8,0x3F,0x08,0x20,0x08,0x20,0x08,0x20,0x10,0x10,0xE0,0x0F,	// 0x44
+	0x08,0x20,0xF8,0x3F,0x88,0x20,0x88,0x20,0xE8,0x23,0x08,0x20,0x10,0x18,	// 0x45
+	0x08,0x20,0xF8,0x3F,0x88,0x20,0x88,0x00,0xE8,0x03,0x08,0x00,0x10,0x00,	// 0x46
+	0xC0,0x07,0x30,0x18,0x08,0x20,0x08,0x20,0x08,0x22,0x38,0x1E,0x00,0x02,	// 0x47
+	0x08,0x20,0xF8,0x3F,0x08,0x21,0x00,0x01,0x00,0x01,0x08,0x21,0xF8,0x3F,0x08,0x20,	// 0x48
+	0x08,0x20,0x08,0x20,0xF8,0x3F,0x08,0x20,0x08,0x20,	// 0x49
+	0x00,0xC0,0x00,0x80,0x08,0x80,0x08,0x80,0xF8,0x7F,0x08,0x00,0x08,0x00,	// 0x4A
+	0x08,0x20,0xF8,0x3F,0x88,0x20,0xC0,0x01,0x28,0x26,0x18,0x38,0x08,0x20,	// 0x4B
+	0x08,0x20,0xF8,0x3F,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x30,	// 0x4C
+	0x08,0x20,0xF8,0x3F,0xF8,0x00,0x00,0x3F,0xF8,0x00,0xF8,0x3F,0x08,0x20,	// 0x4D
+	0x08,0x20,0xF8,0x3F,0x30,0x20,0xC0,0x00,0x00,0x07,0x08,0x18,0xF8,0x3F,0x08,0x00,	// 0x4E
+	0xE0,0x0F,0x10,0x10,0x08,0x20,0x08,0x20,0x08,0x20,0x10,0x10,0xE0,0x0F,	// 0x4F
+	0x08,0x20,0xF8,0x3F,0x08,0x21,0x08,0x01,0x08,0x01,0x08,0x01,0xF0,0x00,	// 0x50
+	0xE0,0x0F,0x10,0x18,0x08,0x24,0x08,0x24,0x08,0x38,0x10,0x50,0xE0,0x4F,	// 0x51
+	0x08,0x20,0xF8,0x3F,0x88,0x20,0x88,0x00,0x88,0x03,0x88,0x0C,0x70,0x30,0x00,0x20,	// 0x52
+	0x70,0x38,0x88,0x20,0x08,0x21,0x08,0x21,0x08,0x22,0x38,0x1C,	// 0x53
+	0x18,0x00,0x08,0x00,0x08,0x20,0xF8,0x3F,0x08,0x20,0x08,0x00,0x18,0x00,	// 0x54
+	0x08,0x00,0xF8,0x1F,0x08,0x20,0x00,0x20,0x00,0x20,0x08,0x20,0xF8,0x1F,0x08,0x00,	// 0x55
+	0x08,0x00,0x78,0x00,0x88,0x07,0x00,0x38,0x00,0x0E,0xC8,0x01,0x38,0x00,0x08,0x00,	// 0x56
+	0xF8,0x03,0x08,0x3C,0x00,0x07,0xF8,0x00,0x00,0x07,0x08,0x3C,0xF8,0x03,	// 0x57
+	0x08,0x20,0x18,0x30,0x68,0x2C,0x80,0x03,0x80,0x03,0x68,0x2C,0x18,0x30,0x08,0x20,	// 0x58
+	0x08,0x00,0x38,0x00,0xC8,0x20,0x00,0x3F,0xC8,0x20,0x38,0x00,0x08,0x00,	// 0x59
+	0x10,0x20,0x08,0x38,0x08,0x26,0x08,0x21,0xC8,0x20,0x38,0x20,0x08,0x18,	// 0x5A
+	0xFE,0x7F,0x02,0x40,0x02,0x40,0x02,0x40,	// 0x5B
+	0x0C,0x00,0x30,0x00,0xC0,0x01,0x00,0x06,0x00,0x38,0x00,0xC0,	// 0x5C
+	0x02,0x40,0x02,0x40,0x02,0x40,0xFE,0x7F,	// 0x5D
+	0x04,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x04,0x00,	// 0x5E
+	0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,	// 0x5F
+	0x02,0x00,0x02,0x00,0x04,0x00,	// 0x60
+	0x00,0x19,0x80,0x24,0x80,0x22,0x80,0x22,0x80,0x22,0x00,0x3F,0x00,0x20,	// 0x61
+	0x08,0x00,0xF8,0x3F,0x00,0x11,0x80,0x20,0x80,0x20,0x00,0x11,0x00,0x0E,	// 0x62
+	0x00,0x0E,0x00,0x11,0x80,0x20,0x80,0x20,0x80,0x20,0x00,0x11,	// 0x63
+	0x00,0x0E,0x00,0x11,0x80,0x20,0x80,0x20,0x88,0x10,0xF8,0x3F,0x00,0x20,	// 0x64
+	0x00,0x1F,0x80,0x22,0x80,0x22,0x80,0x22,0x80,0x22,0x00,0x13,	// 0x65
+	0x80,0x20,0x80,0x20,0xF0,0x3F,0x88,0x20,0x88,0x20,0x88,0x00,0x18,0x00,	// 0x66
+	0x00,0x6B,0x80,0x94,0x80,0x94,0x80,0x94,0x80,0x93,0x80,0x60,	// 0x67
+	0x08,0x20,0xF8,0x3F,0x00,0x21,0x80,0x00,0x80,0x00,0x80,0x20,0x00,0x3F,0x00,0x20,	// 0x68
+	0x80,0x20,0x98,0x20,0x98,0x3F,0x00,0x20,0x00,0x20,	// 0x69
+	0x00,0xC0,0x00,0x80,0x80,0x80,0x98,0x80,0x98,0x7F,	// 0x6A
+	0x08,0x20,0xF8,0x3F,0x00,0x24,0x00,0x02,0x80,0x2D,0x80,0x30,0x80,0x20,	// 0x6B
+	0x08,0x20,0x08,0x20,0xF8,0x3F,0x00,0x20,0x00,0x20,	// 0x6C
+	0x80,0x20,0x80,0x3F,0x80,0x20,0x80,0x00,0x80,0x3F,0x80,0x20,0x80,0x00,0x00,0x3F,	// 0x6D
+	0x80,0x20,0x80,0x3F,0x00,0x21,0x80,0x00,0x80,0x00,0x80,0x20,0x00,0x3F,0x00,0x20,	// 0x6E
+	0x00,0x1F,0x80,0x20,0x80,0x20,0x80,0x20,0x80,0x20,0x00,0x1F,	// 0x6F
+	0x80,0x80,0x80,0xFF,0x00,0xA1,0x80,0x20,0x80,0x20,0x00,0x11,0x00,0x0E,	// 0x70
+	0x00,0x0E,0x00,0x11,0x80,0x20,0x80,0x20,0x80,0xA0,0x80,0xFF,0x00,0x80,	// 0x71
+	0x80,0x20,0x80,0x20,0x80,0x3F,0x00,0x21,0x80,0x20,0x80,0x00,0x80,0x01,	// 0x72
+	0x00,0x33,0x80,0x24,0x80,0x24,0x80,0x24,0x80,0x24,0x80,0x19,	// 0x73
+	0x80,0x00,0x80,0x00,0xE0,0x1F,0x80,0x20,0x80,0x20,	// 0x74
+	0x80,0x00,0x80,0x1F,0x00,0x20,0x00,0x20,0x00,0x20,0x80,0x10,0x80,0x3F,0x00,0x20,	// 0x75
+	0x80,0x00,0x80,0x01,0x80,0x0E,0x00,0x30,0x00,0x08,0x80,0x06,0x80,0x01,0x80,0x00,	// 0x76
+	0x80,0x0F,0x80,0x30,0x00,0x0C,0x80,0x03,0x00,0x0C,0x80,0x30,0x80,0x0F,0x80,0x00,	// 0x77
+	0x80,0x20,0x80,0x31,0x00,0x2E,0x80,0x0E,0x80,0x31,0x80,0x20,	// 0x78
+	0x80,0x80,0x80,0x81,0x80,0x8E,0x00,0x70,0x00,0x18,0x80,0x06,0x80,0x01,0x80,0x00,	// 0x79
+	0x80,0x21,0x80,0x30,0x80,0x2C,0x80,0x22,0x80,0x21,0x80,0x30,	// 0x7A
+	0x80,0x00,0x7C,0x3F,0x02,0x40,0x02,0x40,	// 0x7B
+	0xFF,0xFF,	// 0x7C
+	0x02,0x40,0x02,0x40,0x7C,0x3F,0x80,0x00,	// 0x7D
+	0x06,0x00,0x01,0x00,0x01,0x00,0x02,0x00,0x02,0x00,0x04,0x00,0x04,0x00,	// 0x7E
+};
+
+static const PFontGlyph PFont_Prop16_glyphs[95] = {
+	{    0,  0,  4,  0 },	// 0x20  
+	{    0,  2,  3,  0 },	// 0x21 !
+	{    4,  6,  7,  0 },	// 0x22 "
+	{   16,  7,  8,  0 },	// 0x23 #
+	{   30,  5,  6,  0 },	// 0x24 $
+	{   40,  7,  8,  0 },	// 0x25 %
+	{   54,  8,  9,  0 },	// 0x26 &
+	{   70,  3,  4,  0 },	// 0x27  
+	{   76,  4,  5,  0 },	// 0x28 (
+	{   84,  4,  5,  0 },	// 0x29 )
+	{   92,  7,  8,  0 },	// 0x2A *
+	{  106,  7,  8,  0 },	// 0x2B +
+	{  120,  3,  4,  0 },	// 0x2C ,
+	{  126,  7,  8,  0 },	// 0x2D -
+	{  140,  2,  3,  0 },	// 0x2E .
+	{  144,  7,  8,  0 },	// 0x2F /
+	{  158,  6,  7,  0 },	// 0x30 0
+	{  170,  5,  6,  0 },	// 0x31 1
+	{  180,  6,  7,  0 },	// 0x32 2
+	{  192,  6,  7,  0 },	// 0x33 3
+	{  204,  6,  7,  0 },	// 0x34 4
+	{  216,  6,  7,  0 },	// 0x35 5
+	{  228,  6,  7,  0 },	// 0x36 6
+	{  240,  6,  7,  0 },	// 0x37 7
+	{  252,  6,  7,  0 },	// 0x38 8
+	{  264,  6,  7,  0 },	// 0x39 9
+	{  276,  2,  3,  0 },	// 0x3A :
+	{  280,  2,  3,  0 },	// 0x3B ;
+	{  284,  6,  7,  0 },	// 0x3C <
+	{  296,  7,  8,  0 },	// 0x3D =
+	{  310,  6,  7,  0 },	// 0x3E >
+	{  322,  6,  7,  0 },	// 0x3F ?
+	{  334,  7,  8,  0 },	// 0x40 @
+	{  348,  8,  9,  0 },	// 0x41 A
+	{  364,  7,  8,  0 },	// 0x42 B
+	{  378,  7,  8,  0 },	// 0x43 C
+	{  392,  7,  8,  0 },	// 0x44 D
+	{  406,  7,  8,  0 },	// 0x45 E
+	{  420,  7,  8,  0 },	// 0x46 F
+	{  434,  7,  8,  0 },	// 0x47 G
+	{  448,  8,  9,  0 },	// 0x48 H
+	{  464,  5,  6,  0 },	// 0x49 I
+	{  474,  7,  8,  0 },	// 0x4A J
+	{  488,  7,  8,  0 },	// 0x4B K
+	{  502,  7,  8,  0 },	// 0x4C L
+	{  516,  7,  8,  0 },	// 0x4D M
+	{  530,  8,  9,  0 },	// 0x4E N
+	{  546,  7,  8,  0 },	// 0x4F O
+	{  560,  7,  8,  0 },	// 0x50 P
+	{  574,  7,  8,  0 },	// 0x51 Q
+	{  588,  8,  9,  0 },	// 0x52 R
+	{  604,  6,  7,  0 },	// 0x53 S
+	{  616,  7,  8,  0 },	// 0x54 T
+	{  630,  8,  9,  0 },	// 0x55 U
+	{  646,  8,  9,  0 },	// 0x56 V
+	{  662,  7,  8,  0 },	// 0x57 W
+	{  676,  8,  9,  0 },	// 0x58 X
+	{  692,  7,  8,  0 },	// 0x59 Y
+	{  706,  7,  8,  0 },	// 0x5A Z
+	{  720,  4,  5,  0 },	// 0x5B [
+	{  728,  6,  7,  0 },	// 0x5C  
+	{  740,  4,  5,  0 },	// 0x5D ]
+	{  748,  5,  6,  0 },	// 0x5E ^
+	{  758,  8,  9,  0 },	// 0x5F _
+	{  774,  3,  4,  0 },	// 0x60 `
+	{  780,  7,  8,  0 },	// 0x61 a
+	{  794,  7,  8,  0 },	// 0x62 b
+	{  808,  6,  7,  0 },	// 0x63 c
+	{  820,  7,  8,  0 },	// 0x64 d
+	{  834,  6,  7,  0 },	// 0x65 e
+	{  846,  7,  8,  0 },	// 0x66 f
+	{  860,  6,  7,  0 },	// 0x67 g
+	{  872,  8,  9,  0 },	// 0x68 h
+	{  888,  5,  6,  0 },	// 0x69 i
+	{  898,  5,  6,  0 },	// 0x6A j
+	{  908,  7,  8,  0 },	// 0x6B k
+	{  922,  5,  6,  0 },	// 0x6C l
+	{  932,  8,  9,  0 },	// 0x6D m
+	{  948,  8,  9,  0 },	// 0x6E n
+	{  964,  6,  7,  0 },	// 0x6F o
+	{  976,  7,  8,  0 },	// 0x70 p
+	{  990,  7,  8,  0 },	// 0x71 q
+	{ 1004,  7,  8,  0 },	// 0x72 r
+	{ 1018,  6,  7,  0 },	// 0x73 s
+	{ 1030,  5,  6,  0 },	// 0x74 t
+	{ 1040,  8,  9,  0 },	// 0x75 u
+	{ 1056,  8,  9,  0 },	// 0x76 v
+	{ 1072,  8,  9,  0 },	// 0x77 w
+	{ 1088,  6,  7,  0 },	// 0x78 x
+	{ 1100,  8,  9,  0 },	// 0x79 y
+	{ 1116,  6,  7,  0 },	// 0x7A z
+	{ 1128,  4,  5,  0 },	// 0x7B {
+	{ 1136,  1,  2,  0 },	// 0x7C |
+	{ 1138,  4,  5,  0 },	// 0x7D }
+	{ 1146,  7,  8,  0 },	// 0x7E ~
+};
+
+static const PFontKern PFont_Prop16_kern[27] = {
+	{ 'A','T', -1 },
+	{ 'A','V', -1 },
+	{ 'A','W', -1 },
+	{ 'A','Y', -1 },
+	{ 'F',',', -1 },
+	{ 'F','.', -1 },
+	{ 'L','T', -1 },
+	{ 'L','V', -1 },
+	{ 'L','Y', -1 },
+	{ 'P',',', -1 },
+	{ 'P','.', -1 },
+	{ 'T','A', -1 },
+	{ 'T','a', -1 },
+	{ 'T','e', -1 },
+	{ 'T','o', -1 },
+	{ 'T','y', -1 },
+	{ 'V','A', -1 },
+	{ 'V','a', -1 },
+	{ 'V','e', -1 },
+	{ 'V','o', -1 },
+	{ 'W','A', -1 },
+	{ 'Y','A', -1 },
+	{ 'Y','a', -1 },
+	{ 'Y','e', -1 },
+	{ 'Y','o', -1 },
+	{ 'r',',', -1 },
+	{ 'r','.', -1 },
+};
+
+const PFont PFont_Prop16 = {
+	PFont_Prop16_bitmap,
+	PFont_Prop16_glyphs,
+	PFont_Prop16_kern,
+	27,		// kerning pairs
+	0x20, 0x7E,	// first, last
+	16,		// height
+	13,		// baseline
+	1		// bits per pixel
+};
+
+#endif
@@ -0,0 +1,229 @@
+// Generated by tools/bdf2pfont.py from prop8.bdf - do not edit.
+// 95 glyphs (0x20-0x7E), 8 px high, 1 bpp, 561 bitmap bytes, 11 kerning pairs
+
+#ifndef __PFONT_PROP8_H
+#define __PFONT_PROP8_H
+
+#include "lcd/pfont.h"
+
+static const uint8_t PFont_Prop8_bitmap[561] = {
+	0x06,0x5F,0x5F,0x06,	// 0x21
+	0x07,0x07,0x00,0x07,0x07,	// 0x22
+	0x14,0x7F,0x7F,0x14,0x7F,0x7F,0x14,	// 0x23
+	0x24,0x2E,0x6B,0x6B,0x3A,0x12,	// 0x24
+	0x46,0x66,0x30,0x18,0x0C,0x66,0x62,	// 0x25
+	0x30,0x7A,0x4F,0x5D,0x37,0x7A,0x48,	// 0x26
+	0x04,0x07,0x03,	// 0x27
+	0x1C,0x3E,0x63,0x41,	// 0x28
+	0x41,0x63,0x3E,0x1C,	// 0x29
+	0x08,0x2A,0x3E,0x1C,0x1C,0x3E,0x2A,0x08,	// 0x2A
+	0x08,0x08,0x3E,0x3E,0x08,0x08,	// 0x2B
+	0xA0,0xE0,0x60,	// 0x2C
+	0x08,0x08,0x08,0x08,0x08,0x08,	// 0x2D
+	0x60,0x60,	// 0x2E
+	0x60,0x30,0x18,0x0C,0x06,0x03,0x01,	// 0x2F
+	0x3E,0x7F,0x59,0x4D,0x7F,0x3E,	// 0x30
+	0x42,0x42,0x7F,0x7F,0x40,0x40,	// 0x31
+	0x62,0x73,0x59,0x49,0x6F,0x66,	// 0x32
+	0x22,0x63,0x49,0x49,0x7F,0x36,	// 0x33
+	0x18,0x1C,0x16,0x13,0x7F,0x7F,0x10,	// 0x34
+	0x27,0x67,0x45,0x45,0x7D,0x39,	// 0x35
+	0x3C,0x7E,0x4B,0x49,0x79,0x30,	// 0x36
+	0x03,0x63,0x71,0x19,0x0F,0x07,	// 0x37
+	0x36,0x7F,0x49,0x49,0x7F,0x36,	// 0x38
+	0x06,0x4F,0x49,0x69,0x3F,0x1E,	// 0x39
+	0x6C,0x6C,	// 0x3A
+	0xA0,0xEC,0x6C,	// 0x3B
+	0x08,0x1C,0x36,0x63,0x41,	// 0x3C
+	0x14,0x14,0x14,0x14,0x14,0x14,	// 0x3D
+	0x41,0x63,0x36,0x1C,0x08,	// 0x3E
+	0x02,0x03,0x51,0x59,0x0F,0x06,	// 0x3F
+	0x3E,0x7F,0x41,0x5D,0x5D,0x1F,0x1E,	// 0x40
+	0x7C,0x7E,0x13,0x13,0x7E,0x7C,	// 0x41
+	0x41,0x7F,0x7F,0x49,0x49,0x7F,0x36,	// 0x42
+	0x1C,0x3E,0x63,0x41,0x41,0x63,0x22,	// 0x43
+	0x41,0x7F,0x7F,0x41,0x63,0x7F,0x1C,	// 0x44
+	0x41,0x7F,0x7F,0x49,0x5D,0x41,0x63,	// 0x45
+	0x41,0x7F,0x7F,0x49,0x1D,0x01,0x03,	// 0x46
+	0x1C,0x3E,0x63,0x41,0x51,0x73,0x72,	// 0x47
+	0x7F,0x7F,0x08,0x08,0x7F,0x7F,	// 0x48
+	0x41,0x7F,0x7F,0x41,	// 0x49
+	0x30,0x70,0x40,0x41,0x7F,0x3F,0x01,	// 0x4A
+	0x41,0x7F,0x7F,0x08,0x1C,0x77,0x63,	// 0x4B
+	0x41,0x7F,0x7F,0x41,0x40,0x60,0x70,	// 0x4C
+	0x7F,0x7F,0x06,0x0C,0x06,0x7F,0x7F,	// 0x4D
+	0x7F,0x7F,0x06,0x0C,0x18,0x7F,0x7F,	// 0x4E
+	0x1C,0x3E,0x63,0x41,0x63,0x3E,0x1C,	// 0x4F
+	0x41,0x7F,0x7F,0x49,0x09,0x0F,0x06,	// 0x50
+	0x1E,0x3F,0x21,0x71,0x7F,0x5E,	// 0x51
+	0x41,0x7F,0x7F,0x19,0x39,0x6F,0x46,	// 0x52
+	0x26,0x67,0x4D,0x59,0x7B,0x32,	// 0x53
+	0x03,0x41,0x7F,0x7F,0x41,0x03,	// 0x54
+	0x7F,0x7F,0x40,0x40,0x7F,0x7F,	// 0x55
+	0x1F,0x3F,0x60,0x60,0x3F,0x1F,	// 0x56
+	0x7F,0x7F,0x30,0x18,0x30,0x7F,0x7F,	// 0x57
+	0x63,0x77,0x1C,0x08,0x1C,0x77,0x63,	// 0x58
+	0x07,0x4F,0x78,0x78,0x4F,0x07,	// 0x59
+	0x67,0x73,0x59,0x4D,0x47,0x63,0x71,	// 0x5A
+	0x7F,0x7F,0x41,0x41,	// 0x5B
+	0x01,0x03,0x06,0x0C,0x18,0x30,0x60,	// 0x5C
+	0x41,0x41,0x7F,0x7F,	// 0x5D
+	0x08,0x0C,0x06,0x03,0x06,0x0C,0x08,	// 0x5E
+	0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,	// 0x5F
+	0x03,0x07,0x04,	// 0x60
+	0x20,0x74,0x54,0x54,0x3C,0x78,0x40,	// 0x61
+	0x41,0x3F,0x7F,0x44,0x44,0x7C,0x38,	// 0x62
+	0x38,0x7C,0x44,0x44,0x6C,0x28,	// 0x63
+	0x30,0x78,0x48,0x49,0x3F,0x7F,0x40,	// 0x64
+	0x38,0x7C,0x54,0x54,0x5C,0x18,	// 0x65
+	0x48,0x7E,0x7F,0x49,0x03,0x02,	// 0x66
+	0x98,0xBC,0xA4,0xA4,0xF8,0x7C,0x04,	// 0x67
+	0x41,0x7F,0x7F,0x08,0x04,0x7C,0x78,	// 0x68
+	0x44,0x7D,0x7D,0x40,	// 0x69
+	0x40,0xC4,0x84,0xFD,0x7D,	// 0x6A
+	0x41,0x7F,0x7F,0x10,0x38,0x6C,0x44,	// 0x6B
+	0x41,0x7F,0x7F,0x40,	// 0x6C
+	0x7C,0x7C,0x0C,0x18,0x0C,0x7C,0x78,	// 0x6D
+	0x7C,0x7C,0x04,0x04,0x7C,0x78,	// 0x6E
+	0x38,0x7C,0x44,0x44,0x7C,0x38,	// 0x6F
+	0x84,0xFC,0xF8,0xA4,0x24,0x3C,0x18,	// 0x70
+	0x18,0x3C,0x24,0xA4,0xF8,0xFC,0x84,	// 0x71
+	0x44,0x7C,0x78,0x44,0x1C,0x18,	// 0x72
+	0x48,0x5C,0x54,0x54,0x74,0x24,	// 0x73
+	0x04,0x3E,0x7F,0x44,0x24,	// 0x74
+	0x3C,0x7C,0x40,0x40,0x3C,0x7C,0x40,	// 0x75
+	0x1C,0x3C,0x60,0x60,0x3C,0x1C,	// 0x76
+	0x3C,0x7C,0x60,0x30,0x60,0x7C,0x3C,	// 0x77
+	0x44,0x6C,0x38,0x10,0x38,0x6C,0x44,	// 0x78
+	0x9C,0xBC,0xA0,0xA0,0xFC,0x7C,	// 0x79
+	0x4C,0x64,0x74,0x5C,0x4C,0x64,	// 0x7A
+	0x08,0x08,0x3E,0x77,0x41,0x41,	// 0x7B
+	0x77,0x77,	// 0x7C
+	0x41,0x41,0x77,0x3E,0x08,0x08,	// 0x7D
+	0x02,0x03,0x01,0x03,0x02,0x03,0x01,	// 0x7E
+};
+
+static const PFontGlyph PFont_Prop8_glyphs[95] = {
+	{    0,  0,  3,  0 },	// 0x20  
+	{    0,  4,  5,  0 },	// 0x21 !
+	{    4,  5,  6,  0 },	// 0x22 "
+	{    9,  7,  8,  0 },	// 0x23 #
+	{   16,  6,  7,  0 },	// 0x24 $
+	{   22,  7,  8,  0 },	// 0x25 %
+	{   29,  7,  8,  0 },	// 0x26 &
+	{   36,  3,  4,  0 },	// 0x27  
+	{   39,  4,  5,  0 },	// 0x28 (
+	{   43,  4,  5,  0 },	// 0x29 )
+	{   47,  8,  9,  0 },	// 0x2A *
+	{   55,  6,  7,  0 },	// 0x2B +
+	{   61,  3,  4,  0 },	// 0x2C ,
+	{   64,  6,  7,  0 },	// 0x2D -
+	{   70,  2,  3,  0 },	// 0x2E .
+	{   72,  7,  8,  0 },	// 0x2F /
+	{   79,  6,  7,  0 },	// 0x30 0
+	{   85,  6,  7,  0 },	// 0x31 1
+	{   91,  6,  7,  0 },	// 0x32 2
+	{   97,  6,  7,  0 },	// 0x33 3
+	{  103,  7,  8,  0 },	// 0x34 4
+	{  110,  6,  7,  0 },	// 0x35 5
+	{  116,  6,  7,  0 },	// 0x36 6
+	{  122,  6,  7,  0 },	// 0x37 7
+	{  128,  6,  7,  0 },	// 0x38 8
+	{  134,  6,  7,  0 },	// 0x39 9
+	{  140,  2,  3,  0 },	// 0x3A :
+	{  142,  3,  4,  0 },	// 0x3B ;
+	{  145,  5,  6,  0 },	// 0x3C <
+	{  150,  6,  7,  0 },	// 0x3D =
+	{  156,  5,  6,  0 },	// 0x3E >
+	{  161,  6,  7,  0 },	// 0x3F ?
+	{  167,  7,  8,  0 },	// 0x40 @
+	{  174,  6,  7,  0 },	// 0x41 A
+	{  180,  7,  8,  0 },	// 0x42 B
+	{  187,  7,  8,  0 },	// 0x43 C
+	{  194,  7,  8,  0 },	// 0x44 D
+	{  201,  7,  8,  0 },	// 0x45 E
+	{  208,  7,  8,  0 },	// 0x46 F
+	{  215,  7,  8,  0 },	// 0x47 G
+	{  222,  6,  7,  0 },	// 0x48 H
+	{  228,  4,  5,  0 },	// 0x49 I
+	{  232,  7,  8,  0 },	// 0x4A J
+	{  239,  7,  8,  0 },	// 0x4B K
+	{  246,  7,  8,  0 },	// 0x4C L
+	{  253,  7,  8,  0 },	// 0x4D M
+	{  260,  7,  8,  0 },	// 0x4E N
+	{  267,  7,  8,  0 },	// 0x4F O
+	{  274,  7,  8,  0 },	// 0x50 P
+	{  281,  6,  7,  0 },	// 0x51 Q
+	{  287,  7,  8,  0 },	// 0x52 R
+	{  294,  6,  7,  0 },	// 0x53 S
+	{  300,  6,  7,  0 },	// 0x54 T
+	{  306,  6,  7,  0 },	// 0x55 U
+	{  312,  6,  7,  0 },	// 0x56 V
+	{  318,  7,  8,  0 },	// 0x57 W
+	{  325,  7,  8,  0 },	// 0x58 X
+	{  332,  6,  7,  0 },	// 0x59 Y
+	{  338,  7,  8,  0 },	// 0x5A Z
+	{  345,  4,  5,  0 },	// 0x5B [
+	{  349,  7,  8,  0 },	// 0x5C  
+	{  356,  4,  5,  0 },	// 0x5D ]
+	{  360,  7,  8,  0 },	// 0x5E ^
+	{  367,  8,  9,  0 },	// 0x5F _
+	{  375,  3,  4,  0 },	// 0x60 `
+	{  378,  7,  8,  0 },	// 0x61 a
+	{  385,  7,  8,  0 },	// 0x62 b
+	{  392,  6,  7,  0 },	// 0x63 c
+	{  398,  7,  8,  0 },	// 0x64 d
+	{  405,  6,  7,  0 },	// 0x65 e
+	{  411,  6,  7,  0 },	// 0x66 f
+	{  417,  7,  8,  0 },	// 0x67 g
+	{  424,  7,  8,  0 },	// 0x68 h
+	{  431,  4,  5,  0 },	// 0x69 i
+	{  435,  5,  6,  0 },	// 0x6A j
+	{  440,  7,  8,  0 },	// 0x6B k
+	{  447,  4,  5,  0 },	// 0x6C l
+	{  451,  7,  8,  0 },	// 0x6D m
+	{  458,  6,  7,  0 },	// 0x6E n
+	{  464,  6,  7,  0 },	// 0x6F o
+	{  470,  7,  8,  0 },	// 0x70 p
+	{  477,  7,  8,  0 },	// 0x71 q
+	{  484,  6,  7,  0 },	// 0x72 r
+	{  490,  6,  7,  0 },	// 0x73 s
+	{  496,  5,  6,  0 },	// 0x74 t
+	{  501,  7,  8,  0 },	// 0x75 u
+	{  508,  6,  7,  0 },	// 0x76 v
+	{  514,  7,  8,  0 },	// 0x77 w
+	{  521,  7,  8,  0 },	// 0x78 x
+	{  528,  6,  7,  0 },	// 0x79 y
+	{  534,  6,  7,  0 },	// 0x7A z
+	{  540,  6,  7,  0 },	// 0x7B {
+	{  546,  2,  3,  0 },	// 0x7C |
+	{  548,  6,  7,  0 },	// 0x7D }
+	{  554,  7,  8,  0 },	// 0x7E ~
+};
+
+static const PFontKern PFont_Prop8_kern[11] = {
+	{ 'A','T', -1 },
+	{ 'A','V', -1 },
+	{ 'L','T', -1 },
+	{ 'L','Y', -1 },
+	{ 'T','A', -1 },
+	{ 'T','a', -1 },
+	{ 'T','e', -1 },
+	{ 'T','o', -1 },
+	{ 'V','A', -1 },
+	{ 'Y','a', -1 },
+	{ 'Y','o', -1 },
+};
+
+const PFont PFont_Prop8 = {
+	PFont_Prop8_bitmap,
+	PFont_Prop8_glyphs,
+	PFont_Prop8_kern,
+	11,		// kerning pairs
+	0x20, 0x7E,	// first, last
+	8,		// height
+	7,		// baseline
+	1		// bits per pixel
+};
+
+#endif
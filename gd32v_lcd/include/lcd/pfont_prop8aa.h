@@ -0,0 +1,245 @@
+// Generated by tools/bdf2pfont.py from prop16.bdf - do not edit.
+// 95 glyphs (0x20-0x7E), 8 px high, 4 bpp, 1252 bitmap bytes, 27 kerning pairs
+
+#ifndef __PFONT_PROP8AA_H
+#define __PFONT_PROP8AA_H
+
+#include "lcd/pfont.h"
+
+static const uint8_t PFont_Prop8AA_bitmap[1252] = {
+	0x40,0x88,0x08,0x0F,	// 0x21
+	0x80,0x04,0x00,0x00,0x44,0x04,0x00,0x00,0xB4,0x00,0x00,0x00,	// 0x22
+	0x00,0xB0,0xB8,0x08,0x40,0x88,0x80,0x00,0x40,0xB8,0xB8,0x08,0x00,0x40,0x40,0x00,	// 0x23
+	0x40,0x88,0x40,0x08,0xB0,0x88,0x8B,0x8B,0x00,0x08,0x84,0x04,	// 0x24
+	0x40,0x88,0x04,0x04,0x00,0x88,0x88,0x04,0x40,0x88,0x88,0x08,0x00,0x00,0x84,0x04,	// 0x25
+	0x00,0x88,0x88,0x08,0x80,0x40,0x48,0x08,0x00,0x48,0x8B,0x08,0x00,0x00,0x04,0x08,	// 0x26
+	0x44,0x08,0x00,0x00,0x84,0x00,0x00,0x00,	// 0x27
+	0x40,0x88,0x88,0x04,0x44,0x00,0x00,0x44,	// 0x28
+	0x44,0x00,0x00,0x44,0x40,0x88,0x88,0x04,	// 0x29
+	0x00,0x80,0x08,0x00,0x00,0xB8,0x8B,0x00,0x00,0x80,0x08,0x00,0x00,0x40,0x04,0x00,	// 0x2A
+	0x00,0x00,0x08,0x00,0x00,0x88,0x8B,0x04,0x00,0x00,0x08,0x00,0x00,0x00,0x04,0x00,	// 0x2B
+	0x00,0x00,0x00,0x88,0x00,0x00,0x00,0x48,	// 0x2C
+	0x00,0x00,0x08,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x04,0x00,	// 0x2D
+	0x00,0x00,0x00,0x0F,	// 0x2E
+	0x00,0x00,0x40,0x48,0x00,0x40,0x48,0x00,0x40,0x48,0x00,0x00,0x40,0x00,0x00,0x00,	// 0x2F
+	0x00,0x88,0x88,0x04,0x80,0x00,0x00,0x08,0x00,0x88,0x88,0x04,	// 0x30
+	0x00,0x08,0x00,0x08,0x40,0x88,0x88,0x0B,0x00,0x00,0x00,0x04,	// 0x31
+	0x40,0x48,0x40,0x0B,0x80,0x00,0x44,0x08,0x40,0x88,0x04,0x0B,	// 0x32
+	0x40,0x08,0x40,0x08,0x80,0x80,0x00,0x08,0x40,0x48,0x88,0x04,	// 0x33
+	0x00,0x80,0x88,0x00,0x00,0x08,0x80,0x08,0x40,0x88,0xB8,0x0B,	// 0x34
+	0x80,0x88,0x48,0x08,0x80,0x80,0x00,0x08,0x80,0x00,0x88,0x04,	// 0x35
+	0x00,0x88,0x8B,0x04,0x80,0x80,0x00,0x08,0x40,0x04,0x88,0x04,	// 0x36
+	0x80,0x08,0x00,0x00,0x80,0x80,0x88,0x08,0x80,0x08,0x00,0x00,	// 0x37
+	0x40,0x88,0x84,0x08,0x80,0x00,0x08,0x08,0x40,0x88,0x84,0x08,	// 0x38
+	0x00,0x88,0x04,0x08,0x80,0x00,0x08,0x08,0x00,0x88,0x8B,0x04,	// 0x39
+	0x00,0xF0,0x00,0x0F,	// 0x3A
+	0x00,0x40,0x00,0x84,	// 0x3B
+	0x00,0x40,0x08,0x00,0x00,0x44,0x80,0x00,0x40,0x04,0x00,0x08,	// 0x3C
+	0x00,0x80,0x80,0x00,0x00,0x80,0x80,0x00,0x00,0x80,0x80,0x00,0x00,0x40,0x40,0x00,	// 0x3D
+	0x40,0x04,0x00,0x08,0x00,0x44,0x80,0x00,0x00,0x40,0x08,0x00,	// 0x3E
+	0x40,0x88,0x00,0x00,0x80,0x00,0x44,0x0F,0x40,0x88,0x04,0x00,	// 0x3F
+	0x00,0x88,0x88,0x04,0x80,0x84,0x88,0x08,0x40,0x88,0x48,0x08,0x00,0x84,0x48,0x00,	// 0x40
+	0x00,0x00,0x80,0x0B,0x40,0x88,0x0B,0x04,0x00,0x84,0x4B,0x04,0x00,0x00,0x40,0x0B,	// 0x41
+	0x80,0x88,0x88,0x0B,0x80,0x80,0x00,0x08,0x40,0x88,0x04,0x08,0x00,0x00,0x84,0x00,	// 0x42
+	0x00,0x88,0x88,0x04,0x80,0x00,0x00,0x08,0x80,0x00,0x00,0x08,0x40,0x08,0x40,0x00,	// 0x43
+	0x80,0x88,0x88,0x0B,0x80,0x00,0x00,0x08,0x40,0x04,0x00,0x08,0x00,0x84,0x88,0x00,	// 0x44
+	0x80,0x88,0x88,0x0B,0x80,0x80,0x00,0x08,0x80,0x84,0x08,0x08,0x00,0x04,0x40,0x04,	// 0x45
+	0x80,0x88,0x88,0x0B,0x80,0x80,0x00,0x04,0x80,0x84,0x08,0x00,0x00,0x04,0x00,0x00,	// 0x46
+	0x00,0x88,0x88,0x04,0x80,0x00,0x00,0x08,0x80,0x08,0x88,0x08,0x00,0x00,0x04,0x00,	// 0x47
+	0x80,0x88,0x88,0x0B,0x40,0x00,0x08,0x04,0x40,0x00,0x08,0x04,0x80,0x88,0x88,0x0B,	// 0x48
+	0x80,0x00,0x00,0x08,0x80,0x88,0x88,0x0B,0x40,0x00,0x00,0x04,	// 0x49
+	0x00,0x00,0x00,0xB0,0x80,0x00,0x00,0x80,0x80,0x88,0x88,0x48,0x40,0x00,0x00,0x00,	// 0x4A
+	0x80,0x88,0x88,0x0B,0x40,0xB0,0x04,0x04,0x80,0x08,0x84,0x0B,0x40,0x00,0x00,0x04,	// 0x4B
+	0x80,0x88,0x88,0x0B,0x40,0x00,0x00,0x08,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x08,	// 0x4C
+	0x80,0x88,0x88,0x0B,0x40,0x88,0x88,0x08,0x80,0xFF,0x88,0x08,0x40,0x00,0x00,0x04,	// 0x4D
+	0x80,0x88,0x88,0x0B,0x00,0x88,0x00,0x04,0x40,0x00,0x88,0x04,0x80,0x88,0x88,0x08,	// 0x4E
+	0x00,0x88,0x88,0x04,0x80,0x00,0x00,0x08,0x40,0x04,0x00,0x08,0x00,0x84,0x88,0x00,	// 0x4F
+	0x80,0x88,0x88,0x0B,0x80,0x00,0x08,0x04,0x80,0x00,0x08,0x00,0x00,0x88,0x00,0x00,	// 0x50
+	0x00,0x88,0xB8,0x04,0x80,0x00,0x80,0x08,0x40,0x04,0x40,0x4B,0x00,0x84,0x88,0x40,	// 0x51
+	0x80,0x88,0x88,0x0B,0x80,0x80,0x00,0x04,0x80,0x80,0x88,0x00,0x00,0x48,0x00,0x0B,	// 0x52
+	0x40,0x88,0x40,0x0B,0x80,0x00,0x08,0x08,0x80,0x08,0x84,0x08,	// 0x53
+	0x80,0x04,0x00,0x00,0x80,0x88,0x88,0x0B,0x80,0x00,0x00,0x04,0x40,0x04,0x00,0x00,	// 0x54
+	0x80,0x88,0x88,0x04,0x40,0x00,0x00,0x08,0x40,0x00,0x00,0x08,0x80,0x88,0x88,0x04,	// 0x55
+	0x80,0x48,0x00,0x00,0x40,0x40,0x88,0x08,0x40,0x80,0x88,0x00,0x80,0x08,0x00,0x00,	// 0x56
+	0x80,0x88,0x88,0x08,0x40,0x88,0x48,0x00,0x40,0x00,0xB8,0x08,0x40,0x88,0x08,0x00,	// 0x57
+	0x80,0x04,0x00,0x0B,0x40,0x84,0x88,0x04,0x40,0x84,0x88,0x04,0x80,0x04,0x00,0x0B,	// 0x58
+	0x80,0x08,0x00,0x00,0x40,0x80,0x88,0x0B,0x80,0x88,0x00,0x04,0x40,0x00,0x00,0x00,	// 0x59
+	0x40,0x04,0x40,0x0B,0x80,0x00,0x48,0x08,0x80,0x88,0x00,0x08,0x40,0x00,0x40,0x04,	// 0x5A
+	0x88,0x88,0x88,0x88,0x08,0x00,0x00,0x80,	// 0x5B
+	0x80,0x08,0x00,0x00,0x00,0x80,0x48,0x00,0x00,0x00,0x40,0x88,	// 0x5C
+	0x08,0x00,0x00,0x80,0x88,0x88,0x88,0x88,	// 0x5D
+	0x44,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x40,0x00,0x00,0x00,	// 0x5E
+	0x00,0x00,0x00,0x80,0x00,0x00,0x00,0x80,0x00,0x00,0x00,0x80,0x00,0x00,0x00,0x80,	// 0x5F
+	0x08,0x00,0x00,0x00,0x40,0x00,0x00,0x00,	// 0x60
+	0x00,0x40,0x84,0x08,0x00,0x80,0x08,0x08,0x00,0x40,0x8B,0x0B,0x00,0x00,0x00,0x04,	// 0x61
+	0x80,0x88,0x88,0x08,0x00,0x40,0x04,0x08,0x00,0x40,0x04,0x08,0x00,0x00,0x84,0x00,	// 0x62
+	0x00,0x00,0x88,0x04,0x00,0x80,0x00,0x08,0x00,0x40,0x04,0x08,	// 0x63
+	0x00,0x00,0x88,0x04,0x00,0x80,0x00,0x08,0x80,0xB8,0x88,0x0B,0x00,0x00,0x00,0x04,	// 0x64
+	0x00,0x40,0x8B,0x08,0x00,0x80,0x08,0x08,0x00,0x40,0x0B,0x08,	// 0x65
+	0x00,0x80,0x00,0x08,0x40,0xB8,0x88,0x0B,0x80,0x80,0x00,0x04,0x40,0x04,0x00,0x00,	// 0x66
+	0x00,0x40,0x88,0x88,0x00,0x80,0x80,0x88,0x00,0x80,0x08,0x88,	// 0x67
+	0x80,0x88,0x88,0x0B,0x00,0x40,0x04,0x04,0x00,0x80,0x00,0x04,0x00,0x00,0x88,0x0B,	// 0x68
+	0x40,0x84,0x00,0x08,0x40,0x44,0x88,0x0B,0x00,0x00,0x00,0x04,	// 0x69
+	0x00,0x00,0x00,0xB0,0x40,0x84,0x00,0x80,0x40,0x44,0x88,0x48,	// 0x6A
+	0x80,0x88,0x88,0x0B,0x00,0x00,0x44,0x04,0x00,0x80,0x84,0x0B,0x00,0x40,0x00,0x04,	// 0x6B
+	0x80,0x00,0x00,0x08,0x40,0x88,0x88,0x0B,0x00,0x00,0x00,0x04,	// 0x6C
+	0x00,0x80,0x88,0x0B,0x00,0x80,0x00,0x04,0x00,0x80,0x88,0x0B,0x00,0x40,0x88,0x08,	// 0x6D
+	0x00,0x80,0x88,0x0B,0x00,0x40,0x04,0x04,0x00,0x80,0x00,0x04,0x00,0x00,0x88,0x0B,	// 0x6E
+	0x00,0x40,0x88,0x08,0x00,0x80,0x00,0x08,0x00,0x40,0x88,0x08,	// 0x6F
+	0x00,0x80,0x88,0xB8,0x00,0x40,0x04,0x48,0x00,0x40,0x04,0x08,0x00,0x00,0x84,0x00,	// 0x70
+	0x00,0x00,0x88,0x04,0x00,0x80,0x00,0x08,0x00,0x80,0x88,0xBB,0x00,0x00,0x00,0x40,	// 0x71
+	0x00,0x80,0x00,0x08,0x00,0x40,0x8B,0x0B,0x00,0x80,0x00,0x04,0x00,0x40,0x04,0x00,	// 0x72
+	0x00,0x40,0x48,0x0B,0x00,0x80,0x80,0x08,0x00,0x80,0x84,0x08,	// 0x73
+	0x00,0x80,0x00,0x00,0x00,0xB4,0x88,0x08,0x00,0x40,0x00,0x04,	// 0x74
+	0x00,0x80,0x88,0x04,0x00,0x00,0x00,0x08,0x00,0x40,0x00,0x08,0x00,0x40,0x88,0x0B,	// 0x75
+	0x00,0x80,0x04,0x00,0x00,0x40,0x84,0x08,0x00,0x40,0x84,0x00,0x00,0x80,0x04,0x00,	// 0x76
+	0x00,0x80,0x88,0x08,0x00,0x40,0x88,0x00,0x00,0x40,0x80,0x08,0x00,0x80,0x88,0x00,	// 0x77
+	0x00,0x80,0x04,0x0B,0x00,0x40,0xF8,0x04,0x00,0x80,0x04,0x0B,	// 0x78
+	0x00,0x80,0x04,0x80,0x00,0x40,0x84,0x88,0x00,0x40,0x84,0x04,0x00,0x80,0x04,0x00,	// 0x79
+	0x00,0x80,0x04,0x0B,0x00,0x80,0x84,0x08,0x00,0x80,0x04,0x0B,	// 0x7A
+	0x80,0x88,0x88,0x08,0x08,0x00,0x00,0x80,	// 0x7B
+	0x88,0x88,0x88,0x88,	// 0x7C
+	0x08,0x00,0x00,0x80,0x80,0x88,0x88,0x08,	// 0x7D
+	0x48,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x44,0x00,0x00,0x00,0x40,0x00,0x00,0x00,	// 0x7E
+};
+
+static const PFontGlyph PFont_Prop8AA_glyphs[95] = {
+	{    0,  0,  2,  0 },	// 0x20  
+	{    0,  1,  2,  0 },	// 0x21 !
+	{    4,  3,  4,  0 },	// 0x22 "
+	{   16,  4,  4,  0 },	// 0x23 #
+	{   32,  3,  3,  0 },	// 0x24 $
+	{   44,  4,  4,  0 },	// 0x25 %
+	{   60,  4,  5,  0 },	// 0x26 &
+	{   76,  2,  2,  0 },	// 0x27  
+	{   84,  2,  3,  0 },	// 0x28 (
+	{   92,  2,  3,  0 },	// 0x29 )
+	{  100,  4,  4,  0 },	// 0x2A *
+	{  116,  4,  4,  0 },	// 0x2B +
+	{  132,  2,  2,  0 },	// 0x2C ,
+	{  140,  4,  4,  0 },	// 0x2D -
+	{  156,  1,  2,  0 },	// 0x2E .
+	{  160,  4,  4,  0 },	// 0x2F /
+	{  176,  3,  4,  0 },	// 0x30 0
+	{  188,  3,  3,  0 },	// 0x31 1
+	{  200,  3,  4,  0 },	// 0x32 2
+	{  212,  3,  4,  0 },	// 0x33 3
+	{  224,  3,  4,  0 },	// 0x34 4
+	{  236,  3,  4,  0 },	// 0x35 5
+	{  248,  3,  4,  0 },	// 0x36 6
+	{  260,  3,  4,  0 },	// 0x37 7
+	{  272,  3,  4,  0 },	// 0x38 8
+	{  284,  3,  4,  0 },	// 0x39 9
+	{  296,  1,  2,  0 },	// 0x3A :
+	{  300,  1,  2,  0 },	// 0x3B ;
+	{  304,  3,  4,  0 },	// 0x3C <
+	{  316,  4,  4,  0 },	// 0x3D =
+	{  332,  3,  4,  0 },	// 0x3E >
+	{  344,  3,  4,  0 },	// 0x3F ?
+	{  356,  4,  4,  0 },	// 0x40 @
+	{  372,  4,  5,  0 },	// 0x41 A
+	{  388,  4,  4,  0 },	// 0x42 B
+	{  404,  4,  4,  0 },	// 0x43 C
+	{  420,  4,  4,  0 },	// 0x44 D
+	{  436,  4,  4,  0 },	// 0x45 E
+	{  452,  4,  4,  0 },	// 0x46 F
+	{  468,  4,  4,  0 },	// 0x47 G
+	{  484,  4,  5,  0 },	// 0x48 H
+	{  500,  3,  3,  0 },	// 0x49 I
+	{  512,  4,  4,  0 },	// 0x4A J
+	{  528,  4,  4,  0 },	// 0x4B K
+	{  544,  4,  4,  0 },	// 0x4C L
+	{  560,  4,  4,  0 },	// 0x4D M
+	{  576,  4,  5,  0 },	// 0x4E N
+	{  592,  4,  4,  0 },	// 0x4F O
+	{  608,  4,  4,  0 },	// 0x50 P
+	{  624,  4,  4,  0 },	// 0x51 Q
+	{  640,  4,  5,  0 },	// 0x52 R
+	{  656,  3,  4,  0 },	// 0x53 S
+	{  668,  4,  4,  0 },	// 0x54 T
+	{  684,  4,  5,  0 },	// 0x55 U
+	{  700,  4,  5,  0 },	// 0x56 V
+	{  716,  4,  4,  0 },	// 0x57 W
+	{  732,  4,  5,  0 },	// 0x58 X
+	{  748,  4,  4,  0 },	// 0x59 Y
+	{  764,  4,  4,  0 },	// 0x5A Z
+	{  780,  2,  3,  0 },	// 0x5B [
+	{  788,  3,  4,  0 },	// 0x5C  
+	{  800,  2,  3,  0 },	// 0x5D ]
+	{  808,  3,  3,  0 },	// 0x5E ^
+	{  820,  4,  5,  0 },	// 0x5F _
+	{  836,  2,  2,  0 },	// 0x60 `
+	{  844,  4,  4,  0 },	// 0x61 a
+	{  860,  4,  4,  0 },	// 0x62 b
+	{  876,  3,  4,  0 },	// 0x63 c
+	{  888,  4,  4,  0 },	// 0x64 d
+	{  904,  3,  4,  0 },	// 0x65 e
+	{  916,  4,  4,  0 },	// 0x66 f
+	{  932,  3,  4,  0 },	// 0x67 g
+	{  944,  4,  5,  0 },	// 0x68 h
+	{  960,  3,  3,  0 },	// 0x69 i
+	{  972,  3,  3,  0 },	// 0x6A j
+	{  984,  4,  4,  0 },	// 0x6B k
+	{ 1000,  3,  3,  0 },	// 0x6C l
+	{ 1012,  4,  5,  0 },	// 0x6D m
+	{ 1028,  4,  5,  0 },	// 0x6E n
+	{ 1044,  3,  4,  0 },	// 0x6F o
+	{ 1056,  4,  4,  0 },	// 0x70 p
+	{ 1072,  4,  4,  0 },	// 0x71 q
+	{ 1088,  4,  4,  0 },	// 0x72 r
+	{ 1104,  3,  4,  0 },	// 0x73 s
+	{ 1116,  3,  3,  0 },	// 0x74 t
+	{ 1128,  4,  5,  0 },	// 0x75 u
+	{ 1144,  4,  5,  0 },	// 0x76 v
+	{ 1160,  4,  5,  0 },	// 0x77 w
+	{ 1176,  3,  4,  0 },	// 0x78 x
+	{ 1188,  4,  5,  0 },	// 0x79 y
+	{ 1204,  3,  4,  0 },	// 0x7A z
+	{ 1216,  2,  3,  0 },	// 0x7B {
+	{ 1224,  1,  1,  0 },	// 0x7C |
+	{ 1228,  2,  3,  0 },	// 0x7D }
+	{ 1236,  4,  4,  0 },	// 0x7E ~
+};
+
+static const PFontKern PFont_Prop8AA_kern[27] = {
+	{ 'A','T', -1 },
+	{ 'A','V', -1 },
+	{ 'A','W', -1 },
+	{ 'A','Y', -1 },
+	{ 'F',',', -1 },
+	{ 'F','.', -1 },
+	{ 'L','T', -1 },
+	{ 'L','V', -1 },
+	{ 'L','Y', -1 },
+	{ 'P',',', -1 },
+	{ 'P','.', -1 },
+	{ 'T','A', -1 },
+	{ 'T','a', -1 },
+	{ 'T','e', -1 },
+	{ 'T','o', -1 },
+	{ 'T','y', -1 },
+	{ 'V','A', -1 },
+	{ 'V','a', -1 },
+	{ 'V','e', -1 },
+	{ 'V','o', -1 },
+	{ 'W','A', -1 },
+	{ 'Y','A', -1 },
+	{ 'Y','a', -1 },
+	{ 'Y','e', -1 },
+	{ 'Y','o', -1 },
+	{ 'r',',', -1 },
+	{ 'r','.', -1 },
+};
+
+const PFont PFont_Prop8AA = {
+	PFont_Prop8AA_bitmap,
+	PFont_Prop8AA_glyphs,
+	PFont_Prop8AA_kern,
+	27,		// kerning pairs
+	0x20, 0x7E,	// first, last
+	8,		// height
+	6,		// baseline
+	4		// bits per pixel
+};
+
+#endif
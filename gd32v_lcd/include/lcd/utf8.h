@@ -0,0 +1,23 @@
+#ifndef __UTF8_H
+#define __UTF8_H
+
+// UTF-8 text for the LCD string routines.
+// Strings are decoded to Unicode code points, which are then mapped to
+// glyphs of the fonts we have: the CP437 BasicFont or the 8x16 ASCII font.
+// Bytes that are not valid UTF-8 come out as U+DC80..U+DCFF ("escaped"
+// raw bytes), and those map straight to the CP437 glyph of the same number,
+// so old strings with raw CP437 bytes still print as before.
+
+#include <stdint.h>
+
+typedef unsigned char u8;       // As in lcd.h: this header also builds on the host
+typedef unsigned long u32;
+
+#define UTF8_RAW(b)     (0xDC00 | (b))      // Escaped raw byte
+#define UTF8_IS_RAW(cp) (((cp) & 0xFF80) == 0xDC80)
+
+u32 UTF8_Next(const u8 **p);                // Decode one code point, advance p
+u8  CP437_Glyph(u32 cp);                    // Code point -> BasicFont index
+u8  ASC16_Glyph(u32 cp);                    // Code point -> asc2_1608 character
+
+#endif
@@ -0,0 +1,33 @@
+#ifndef __LOGGER_H
+#define __LOGGER_H
+
+// Append-only logger on the TF card.
+// Records are collected in a sector buffer and written as whole, aligned
+// sectors, which FatFs passes straight to the card. f_sync (directory
+// entry, FAT) runs every LOG_SYNC_MS at most, not per record.
+// Unsynced data is lost on power failure: at most one buffer plus
+// LOG_SYNC_MS worth of sectors.
+
+#include "fatfs/ff.h"
+#include "systick.h"
+
+#define LOG_SYNC_MS     5000    // Longest time between f_sync calls
+
+typedef struct {
+    FIL fil;
+    BYTE buf[512];
+    UINT fill;                  // Bytes in buf
+    UINT room;                  // Buffer size up to the next sector boundary of the file
+    uint32_t sync_due;          // systick_ms of the next f_sync
+    // Statistics
+    uint32_t bytes;             // Record bytes logged
+    uint32_t sectors;           // Sectors handed to f_write
+    uint32_t syncs;
+} Logger;
+
+FRESULT log_open(Logger *lg, const char *path);                 // Appends to an existing file
+FRESULT log_write(Logger *lg, const void *rec, UINT len);
+FRESULT log_flush(Logger *lg);                                  // Write out the buffer and f_sync
+FRESULT log_close(Logger *lg);
+
+#endif
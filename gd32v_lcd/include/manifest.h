@@ -0,0 +1,37 @@
+#ifndef __MANIFEST_H
+#define __MANIFEST_H
+
+// Asset manifest: files opened by their start cluster instead of by name.
+// tools/mkmanifest.py reads the card (or its image) and writes a small
+// table of the assets' start clusters and sizes to a file on the card.
+// manifest_load checks it against the mounted volume's serial number and
+// cluster count; manifest_open then needs no directory search at all.
+// Names that are not in the manifest, or a manifest that does not match,
+// fall back to f_open. Run the tool again after changing the assets.
+
+#include "fatfs/ff.h"
+
+#define MANIFEST_MAGIC      0x31464D41      // "AMF1"
+#define MANIFEST_MAX        8               // Entries kept in RAM
+#define MANIFEST_NAME       20              // Bytes per name, with the NUL
+#define MANIFEST_CONTIG     0x01            // Flag: clusters are back to back
+
+typedef struct {                // File header, little endian
+    DWORD magic;
+    DWORD vsn;                  // Volume serial number (BS_VolID)
+    DWORD clusters;             // Data clusters on the volume
+    DWORD count;                // Entries that follow
+} ManifestHeader;
+
+typedef struct {                // One entry per asset, 32 bytes
+    char name[MANIFEST_NAME];   // Path as given to f_open, upper case
+    DWORD sclust;               // Start cluster (0: empty file)
+    DWORD size;                 // Bytes
+    DWORD flags;                // MANIFEST_xxx
+} ManifestEntry;
+
+// FR_OK: manifest in use; FR_INVALID_OBJECT: not a manifest, or one made for another volume
+FRESULT manifest_load(const char *path);
+FRESULT manifest_open(FIL *fp, const char *name);   // Read only
+
+#endif
@@ -0,0 +1,31 @@
+#ifndef __PLAYER_H
+#define __PLAYER_H
+
+// Video player for raw RGB565 frame files (160x80, high byte first,
+// FRAME_SIZE bytes per frame, frames back to back - like bmp.bin).
+// Frames are paced on the mtime counter. A frame that cannot be shown
+// before the next one is due is skipped: the player seeks straight to
+// the frame that is due now.
+
+#include "lcd/lcd.h"
+#include "fatfs/tf_card.h"
+
+#define PLAYER_FPS      10      // bmp.bin: 2189 frames, 3:39 min
+
+typedef struct {
+    FIL fil;
+    uint32_t frames;            // Frames in the file
+    uint32_t frame;             // Frame being loaded
+    uint8_t band;               // Next quarter of that frame
+    uint32_t period;            // mtime ticks per frame
+    uint64_t t0;                // mtime when frame 0 was due
+    // Statistics, reset every second
+    uint32_t shown, late, dropped;
+    uint32_t report;            // systick_ms of the next report
+} Player;
+
+FRESULT player_open(Player *p, const char *path, uint16_t fps);
+int player_step(Player *p);     // Poll often; returns 0 at the end of the file
+void player_close(Player *p);
+
+#endif
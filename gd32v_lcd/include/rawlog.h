@@ -0,0 +1,34 @@
+#ifndef __RAWLOG_H
+#define __RAWLOG_H
+
+// Pre-allocated log files with constant-time writes.
+// The file is created once at its full size as one contiguous block of
+// clusters (f_expand). After that, sectors are written straight to their
+// LBA with disk_write: no FAT scan, no directory update, no cluster chain.
+// Sector 0 of the file is a header that records how much has been written;
+// it is rewritten every RAWLOG_HDR_EVERY data sectors and by rawlog_sync.
+
+#include "fatfs/ff.h"
+#include "fatfs/diskio.h"
+
+#define RAWLOG_MAGIC        0x474F4C52      // "RLOG"
+#define RAWLOG_HDR_EVERY    64              // Data sectors between header updates
+
+typedef struct {                // Sector 0 of the file, little endian
+    DWORD magic;
+    DWORD sectors;              // Data sectors in the file, after the header
+    DWORD fill;                 // Data sectors written
+    DWORD seq;                  // Header updates so far
+} RawLogHeader;
+
+typedef struct {
+    DWORD lba;                  // Header sector on the card
+    RawLogHeader hdr;
+    DWORD unsaved;              // Data sectors written since the header
+} RawLog;
+
+FRESULT rawlog_open(RawLog *rl, const char *path, DWORD sectors);  // Creates the file if needed
+FRESULT rawlog_write(RawLog *rl, const BYTE *buff, UINT count);      // Whole sectors
+FRESULT rawlog_sync(RawLog *rl);                                     // Write the header
+
+#endif
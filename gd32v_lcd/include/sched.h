@@ -0,0 +1,17 @@
+#ifndef __SCHED_H
+#define __SCHED_H
+
+// Cooperative scheduler: tasks are plain functions that do a bit of work
+// and return. sched_run() calls them in turn, each at its period.
+// Nobody preempts anybody: a task that spins blocks all others.
+
+#include <stdint.h>
+
+#define SCHED_TASKS     6
+
+typedef void (*sched_fn)(void);
+
+int sched_add(sched_fn fn, uint32_t period_ms);    // 0 ms: on every pass
+void sched_run(void);                               // Never returns
+
+#endif
@@ -37,6 +37,22 @@ OF SUCH DAMAGE.
 
 #include <stdint.h>
 
+#define SYSTICK_HOOKS   4       /* functions called from the 1ms tick interrupt */
+
+/* millisecond tick, counted by the machine timer compare interrupt */
+extern volatile uint32_t systick_ms;
+
+void systick_init(void);
+int systick_add_hook(void (*fn)(void));
 void delay_1ms(uint32_t count);
 
+/* non-blocking timer: start it, then poll */
+typedef struct {
+    uint32_t start;
+    uint32_t ms;
+} soft_timer;
+
+void soft_timer_start(soft_timer *t, uint32_t ms);
+int soft_timer_expired(const soft_timer *t);
+
 #endif /* SYS_TICK_H */
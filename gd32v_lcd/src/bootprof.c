@@ -0,0 +1,48 @@
+/**************************************************************************
+ * Boot profiler
+ * Code CC-BY untergeekDE
+ *
+ * Where do the milliseconds between reset and the first picture go?
+ * BootProf_Mark() stores the mtime counter at the end of each phase,
+ * BootProf_Report() prints how long every phase took. mtime starts at 0
+ * on reset, so the first mark also shows the startup code before main().
+ * *******************************************************************************/
+
+#include <stdio.h>
+#include "gd32vf103.h"
+#include "bootprof.h"
+
+#if BOOTPROF
+static struct {
+	const char *phase;
+	uint32_t t;					// mtime, low word: wraps after ~159s
+} bp_marks[BOOTPROF_MAX];
+static uint8_t bp_count;
+
+void BootProf_Mark(const char *phase)
+{
+	if (bp_count >= BOOTPROF_MAX) return;
+	bp_marks[bp_count].phase = phase;
+	bp_marks[bp_count].t = (uint32_t)get_timer_value();
+	bp_count++;
+}
+
+/******************************************************************************
+       Function description: print the boot phases
+       One line per mark: time spent since the previous mark, and since reset,
+       both in microseconds.
+******************************************************************************/
+void BootProf_Report(void)
+{
+	const uint32_t per_us = SystemCoreClock / 4000000;	// mtime ticks per us
+	uint32_t prev = 0;
+
+	for (uint8_t i = 0; i < bp_count; i++)
+	{
+		printf("boot %-12s %7lu us  (at %7lu us)\n\r", bp_marks[i].phase,
+		       (unsigned long)((bp_marks[i].t - prev) / per_us),
+		       (unsigned long)(bp_marks[i].t / per_us));
+		prev = bp_marks[i].t;
+	}
+}
+#endif
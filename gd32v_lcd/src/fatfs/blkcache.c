@@ -0,0 +1,171 @@
+/*-----------------------------------------------------------------------*/
+/* Sector cache between FatFs and the disk driver                        */
+/*-----------------------------------------------------------------------*/
+/*
+/  FatFs keeps one sector in its window. Following a FAT chain, scanning
+/  a directory or reading a file in pieces keeps loading the same few
+/  sectors again. This cache holds BLKCACHE_LINES lines of BLKCACHE_SPL
+/  consecutive sectors each:
+/
+/  - Single sector reads are looked up; a miss loads a whole line starting
+/    at the missing sector, so the next FAT or directory sector comes
+/    along (read-ahead).
+/  - Multi sector reads are file data going straight to the user buffer.
+/    They pass through and do not push the FAT out of the cache. Single
+/    sectors that continue such a read are file data, too: they are loaded
+/    alone, so the driver still sees one sequential stream.
+/  - The least recently used line is replaced, but lines in a pinned range
+/    (the FAT, the root directory) only when all lines are pinned.
+/
+/  The cache knows nothing about the card: the driver hands in its read
+/  function with blkcache_init().
+/----------------------------------------------------------------------*/
+
+#include <string.h>
+#include "fatfs/blkcache.h"
+
+typedef struct {
+	DWORD sector;		/* First sector in the line */
+	UINT n;				/* Valid sectors, 0: line is empty */
+	DWORD used;			/* Stamp of the last hit, for LRU */
+} BlkLine;
+
+typedef struct {
+	DWORD sector, count;
+} BlkPin;
+
+static BYTE bc_data[BLKCACHE_LINES][BLKCACHE_SPL * 512];
+static BlkLine bc_line[BLKCACHE_LINES];
+static BlkPin bc_pin[BLKCACHE_PINS];
+static DWORD bc_clock;					/* LRU stamp source */
+static BlkCacheStats bc_stats;
+static blkcache_read_fn bc_read;
+static DWORD bc_next;					/* Sector after the last pass-through read */
+
+
+void blkcache_init (
+	blkcache_read_fn read	/* Driver read function */
+)
+{
+	memset(bc_line, 0, sizeof bc_line);
+	memset(bc_pin, 0, sizeof bc_pin);
+	memset(&bc_stats, 0, sizeof bc_stats);
+	bc_read = read;
+	bc_next = 0xFFFFFFFF;
+}
+
+
+static
+int pinned (DWORD sector)
+{
+	UINT i;
+
+	for (i = 0; i < BLKCACHE_PINS; i++) {
+		if (sector - bc_pin[i].sector < bc_pin[i].count) return 1;
+	}
+	return 0;
+}
+
+
+int blkcache_pin (
+	DWORD sector,	/* First sector to keep */
+	DWORD count		/* Number of sectors */
+)
+{
+	UINT i;
+
+	for (i = 0; i < BLKCACHE_PINS; i++) {
+		if (!bc_pin[i].count || bc_pin[i].sector == sector) {
+			bc_pin[i].sector = sector;
+			bc_pin[i].count = count;
+			return 1;
+		}
+	}
+	return 0;
+}
+
+
+void blkcache_invalidate (
+	DWORD sector,	/* First changed sector */
+	UINT count		/* Number of sectors */
+)
+{
+	UINT i;
+
+	for (i = 0; i < BLKCACHE_LINES; i++) {
+		BlkLine *l = &bc_line[i];
+		if (l->n && sector < l->sector + l->n && l->sector < sector + count) l->n = 0;
+	}
+}
+
+
+const BlkCacheStats *blkcache_stats (void)
+{
+	return &bc_stats;
+}
+
+
+/* Line to load a new sector into: an empty one, else LRU, unpinned first */
+static
+BlkLine *victim (void)
+{
+	BlkLine *v = 0, *vp = 0;
+	UINT i;
+
+	for (i = 0; i < BLKCACHE_LINES; i++) {
+		BlkLine *l = &bc_line[i];
+		if (!l->n) return l;
+		if (pinned(l->sector)) {
+			if (!vp || l->used < vp->used) vp = l;
+		} else {
+			if (!v || l->used < v->used) v = l;
+		}
+	}
+	bc_stats.evictions++;
+	return v ? v : vp;
+}
+
+
+DRESULT blkcache_read (
+	BYTE *buff,		/* Pointer to the data buffer to store read data */
+	DWORD sector,	/* Start sector number (LBA) */
+	UINT count		/* Number of sectors to read */
+)
+{
+	BlkLine *l;
+	UINT i;
+
+	if (count > 1) {					/* File data: pass through */
+		bc_stats.bypass++;
+		bc_next = sector + count;
+		return bc_read(buff, sector, count);
+	}
+
+	for (i = 0; i < BLKCACHE_LINES; i++) {
+		l = &bc_line[i];
+		if (l->n && sector - l->sector < l->n) {	/* Hit */
+			memcpy(buff, bc_data[i] + (sector - l->sector) * 512, 512);
+			l->used = ++bc_clock;
+			bc_stats.hits++;
+			return RES_OK;
+		}
+	}
+
+	bc_stats.misses++;
+	l = victim();
+	i = l - bc_line;
+	l->n = 0;
+	if (sector == bc_next) {			/* Still file data: no read-ahead */
+		bc_next++;
+	} else if (bc_read(bc_data[i], sector, BLKCACHE_SPL) == RES_OK) {
+		l->n = BLKCACHE_SPL;
+	}
+	if (!l->n) {						/* One sector (also at the end of the disk) */
+		if (bc_read(bc_data[i], sector, 1) != RES_OK) return RES_ERROR;
+		l->n = 1;
+	}
+	l->sector = sector;
+	l->used = ++bc_clock;
+	memcpy(buff, bc_data[i], 512);
+	return RES_OK;
+}
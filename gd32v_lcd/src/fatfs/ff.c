@@ -452,6 +452,30 @@ static const char* const VolumeStr[FF_VOLUMES] = {FF_VOLUME_STRS};	/* Pre-define
 #endif
 #endif
 
+#if FF_DIR_INDEX && !FF_USE_LFN
+#if FF_DIR_INDEX > 65536
+#error Wrong FF_DIR_INDEX setting
+#endif
+#if FF_DIR_INDEX_DIRS < 1
+#error Wrong FF_DIR_INDEX_DIRS setting
+#endif
+#define DIDX_VALID	1				/* Index holds the directory id/clust */
+#define DIDX_FULL	2				/* The directory goes on past FF_DIR_INDEX entries */
+typedef struct {
+	WORD id;						/* Volume mount ID of the indexed directory */
+	DWORD clust;					/* Start cluster of the indexed directory (0:root on FAT12/16) */
+	DWORD used;						/* Lookup stamp, for replacing the least recently used index */
+	BYTE stat;						/* DIDX_xxx flags */
+	UINT cnt;						/* Entries up to the end of the table (or FF_DIR_INDEX) */
+	BYTE tag[FF_DIR_INDEX];			/* Name hash of each entry (0:free, deleted or volume label) */
+} DIRIDX;
+static DIRIDX DirIdx[FF_DIR_INDEX_DIRS];	/* Indexes of the directories searched last */
+static DWORD DidxStamp;				/* Lookup counter */
+static WORD DidxSeenId[FF_DIR_INDEX_DIRS];		/* Directories searched once without an index: */
+static DWORD DidxSeenClust[FF_DIR_INDEX_DIRS];	/* the second search there builds one */
+static UINT DidxSeen;				/* Next DidxSeenxxx[] item to be replaced */
+#endif
+
 
 /*--------------------------------*/
 /* LFN/Directory working buffer   */
@@ -2405,6 +2429,122 @@ static FRESULT dir_read (
 
 
 
+#if FF_DIR_INDEX && !FF_USE_LFN
+/*-----------------------------------------------------------------------*/
+/* Directory index - Hash of the SFN, index lookup and adding an entry   */
+/*-----------------------------------------------------------------------*/
+
+static BYTE didx_hash (	/* 1..255: FNV-1a hash of the SFN, folded to a byte */
+	const BYTE* sfn			/* 11-byte SFN as in the entry */
+)
+{
+	DWORD h = 2166136261UL;
+	UINT n = 11;
+
+
+	do h = (h ^ *sfn++) * 16777619UL; while (--n);
+	h ^= h >> 16; h ^= h >> 8;
+	return (BYTE)h ? (BYTE)h : 1;
+}
+
+
+static DIRIDX* didx_get (	/* Index of the directory, 0:not indexed */
+	DIR* dp					/* Directory object */
+)
+{
+	UINT i;
+
+
+	for (i = 0; i < FF_DIR_INDEX_DIRS; i++) {
+		if ((DirIdx[i].stat & DIDX_VALID) && DirIdx[i].id == dp->obj.fs->id && DirIdx[i].clust == dp->obj.sclust) {
+			return &DirIdx[i];
+		}
+	}
+	return 0;
+}
+
+
+static void didx_set (
+	DIRIDX* ix,				/* Index of the directory */
+	DIR* dp					/* Directory object pointing the entry that has changed */
+)
+{
+	DWORD ent = dp->dptr / SZDIRE;
+	BYTE c = dp->dir[DIR_Name];
+
+
+	if (ent >= FF_DIR_INDEX) {	/* Past the index: searched by scan */
+		ix->stat |= DIDX_FULL;
+		return;
+	}
+	ix->tag[ent] = (c != 0 && c != DDEM && !(dp->dir[DIR_Attr] & AM_VOL)) ? didx_hash(dp->dir) : 0;
+	if (ent >= ix->cnt) ix->cnt = ent + 1;
+}
+
+
+#if !FF_FS_READONLY && FF_FS_MINIMIZE == 0
+static void didx_remove (
+	DIR* dp					/* Directory object pointing the entry being removed */
+)
+{
+	DIRIDX *ix = didx_get(dp);
+	DWORD cl;
+	UINT i;
+
+
+	if (ix) didx_set(ix, dp);
+	if (dp->dir[DIR_Attr] & AM_DIR) {	/* A sub-directory: a new one may get its cluster */
+		cl = ld_clust(dp->obj.fs, dp->dir);
+		for (i = 0; i < FF_DIR_INDEX_DIRS; i++) {
+			if (DirIdx[i].clust == cl) DirIdx[i].stat = 0;
+		}
+	}
+}
+#endif
+
+
+/*-----------------------------------------------------------------------*/
+/* Directory index - Build the index of a directory                      */
+/*-----------------------------------------------------------------------*/
+
+static FRESULT didx_build (	/* FR_OK(0):succeeded, !=0:error */
+	DIR* dp,				/* Directory object to be indexed */
+	DIRIDX** pix			/* Pointer to return the index */
+)
+{
+	FRESULT res;
+	FATFS *fs = dp->obj.fs;
+	DIRIDX *ix = &DirIdx[0];
+	UINT i;
+
+
+	for (i = 1; i < FF_DIR_INDEX_DIRS; i++) {	/* Take the least recently used index */
+		if (DidxStamp - DirIdx[i].used > DidxStamp - ix->used) ix = &DirIdx[i];
+	}
+	ix->stat = 0; ix->cnt = 0;
+	mem_set(ix->tag, 0, FF_DIR_INDEX);
+	res = dir_sdi(dp, 0);
+	while (res == FR_OK) {
+		res = move_window(fs, dp->sect);
+		if (res != FR_OK) break;
+		if (dp->dir[DIR_Name] == 0) break;	/* Reached to end of table */
+		didx_set(ix, dp);
+		if (ix->stat & DIDX_FULL) break;	/* The rest is not indexed */
+		res = dir_next(dp, 0);
+	}
+	if (res == FR_NO_FILE) res = FR_OK;		/* End of the directory */
+	if (res == FR_OK) {
+		ix->id = fs->id; ix->clust = dp->obj.sclust;
+		ix->stat |= DIDX_VALID;
+		*pix = ix;
+	}
+	return res;
+}
+
+#endif	/* FF_DIR_INDEX && !FF_USE_LFN */
+
+
+
 /*-----------------------------------------------------------------------*/
 /* Directory handling - Find an object in the directory                  */
 /*-----------------------------------------------------------------------*/
@@ -2419,8 +2559,42 @@ static FRESULT dir_find (	/* FR_OK(0):succeeded, !=0:error */
 #if FF_USE_LFN
 	BYTE a, ord, sum;
 #endif
+#if FF_DIR_INDEX && !FF_USE_LFN
+	DIRIDX *ix;
+	BYTE h;
+	UINT i;
 
+	ix = didx_get(dp);
+	if (!ix) {	/* Not indexed: a single search is faster by scan, index the directory on the second one */
+		for (i = 0; i < FF_DIR_INDEX_DIRS && (DidxSeenId[i] != fs->id || DidxSeenClust[i] != dp->obj.sclust); i++) ;
+		if (i < FF_DIR_INDEX_DIRS) {
+			DidxSeenId[i] = 0;
+			res = didx_build(dp, &ix);
+			if (res != FR_OK) return res;
+		} else {
+			DidxSeenId[DidxSeen] = fs->id; DidxSeenClust[DidxSeen] = dp->obj.sclust;
+			DidxSeen = (DidxSeen + 1) % FF_DIR_INDEX_DIRS;
+		}
+	}
+	if (ix) {
+		ix->used = ++DidxStamp;
+		h = didx_hash(dp->fn);
+		for (i = 0; i < ix->cnt; i++) {
+			if (ix->tag[i] != h) continue;
+			res = dir_sdi(dp, (DWORD)i * SZDIRE);	/* Check the entry itself */
+			if (res == FR_OK) res = move_window(fs, dp->sect);
+			if (res != FR_OK) return res;
+			if (!(dp->dir[DIR_Attr] & AM_VOL) && !mem_cmp(dp->dir, dp->fn, 11)) {	/* Name matched? */
+				dp->obj.attr = dp->dir[DIR_Attr] & AM_MASK;
+				return FR_OK;
+			}
+		}
+		if (!(ix->stat & DIDX_FULL)) return FR_NO_FILE;	/* The index holds every name */
+	}
+	res = dir_sdi(dp, ix ? (DWORD)FF_DIR_INDEX * SZDIRE : 0);	/* Scan what the index does not cover */
+#else
 	res = dir_sdi(dp, 0);			/* Rewind directory object */
+#endif
 	if (res != FR_OK) return res;
 #if FF_FS_EXFAT
 	if (fs->fs_type == FS_EXFAT) {	/* On the exFAT volume */
@@ -2496,6 +2670,9 @@ static FRESULT dir_register (	/* FR_OK:succeeded, FR_DENIED:no free entry or too
 {
 	FRESULT res;
 	FATFS *fs = dp->obj.fs;
+#if FF_DIR_INDEX && !FF_USE_LFN
+	DIRIDX *ix;
+#endif
 #if FF_USE_LFN		/* LFN configuration */
 	UINT n, nlen, nent;
 	BYTE sn[12], sum;
@@ -2581,6 +2758,10 @@ static FRESULT dir_register (	/* FR_OK:succeeded, FR_DENIED:no free entry or too
 			dp->dir[DIR_NTres] = dp->fn[NSFLAG] & (NS_BODY | NS_EXT);	/* Put NT flag */
 #endif
 			fs->wflag = 1;
+#if FF_DIR_INDEX && !FF_USE_LFN
+			ix = didx_get(dp);
+			if (ix) didx_set(ix, dp);	/* Keep the index up to date */
+#endif
 		}
 	}
 
@@ -2627,6 +2808,9 @@ static FRESULT dir_remove (	/* FR_OK:Succeeded, FR_DISK_ERR:A disk error */
 	if (res == FR_OK) {
 		dp->dir[DIR_Name] = DDEM;	/* Mark the entry 'deleted'.*/
 		fs->wflag = 1;
+#if FF_DIR_INDEX
+		didx_remove(dp);			/* Keep the indexes up to date */
+#endif
 	}
 #endif
 
@@ -5450,6 +5634,109 @@ FRESULT f_expand (
 
 
 
+#if FF_USE_OPENAT
+#if FF_FS_LOCK != 0
+#error FF_USE_OPENAT cannot be used with FF_FS_LOCK
+#endif
+/*-----------------------------------------------------------------------*/
+/* Open a File by its Start Cluster and Size                             */
+/*-----------------------------------------------------------------------*/
+
+FRESULT f_open_at (
+	FIL* fp,			/* Pointer to the blank file object */
+	const TCHAR* path,	/* Logical drive number */
+	DWORD sclust,		/* Start cluster of the file (0:empty file) */
+	FSIZE_t size		/* File size in bytes */
+)
+{
+	FRESULT res;
+	FATFS *fs;
+	DWORD bcs;
+
+
+	if (!fp) return FR_INVALID_OBJECT;
+
+	/* Get logical drive number */
+	res = find_volume(&path, &fs, 0);
+	if (res == FR_OK) {
+#if FF_FS_EXFAT
+		if (fs->fs_type == FS_EXFAT) res = FR_DENIED;	/* exFAT needs the directory entry */
+#endif
+		bcs = (DWORD)fs->csize * SS(fs);	/* Cluster size in byte */
+		if (sclust == 0) {
+			if (size != 0) res = FR_INVALID_PARAMETER;	/* Data without a cluster */
+		} else {
+			if (sclust < 2 || sclust >= fs->n_fatent || (size > 0 && (DWORD)((size - 1) / bcs) >= fs->n_fatent - sclust)) {
+				res = FR_INVALID_PARAMETER;		/* Out of the volume */
+			}
+		}
+	}
+	if (res == FR_OK) {
+		fp->obj.sclust = sclust;	/* Set object allocation info */
+		fp->obj.objsize = size;
+#if FF_USE_FASTSEEK
+		fp->cltbl = 0;			/* Disable fast seek mode */
+#endif
+		fp->obj.fs = fs;	 	/* Validate the file object */
+		fp->obj.id = fs->id;
+		fp->flag = FA_READ;		/* Read only: there is no directory entry to update */
+		fp->err = 0;			/* Clear error flag */
+		fp->sect = 0;			/* Invalidate current data sector */
+		fp->fptr = 0;			/* Set file pointer top of the file */
+#if !FF_FS_READONLY
+		fp->dir_sect = 0;
+		fp->dir_ptr = 0;
+#if !FF_FS_TINY
+		mem_set(fp->buf, 0, sizeof fp->buf);	/* Clear sector buffer */
+#endif
+#endif
+	}
+
+	if (res != FR_OK) fp->obj.fs = 0;	/* Invalidate file object on error */
+
+	LEAVE_FF(fs, res);
+}
+
+
+
+/*-----------------------------------------------------------------------*/
+/* Get Volume Serial Number                                              */
+/*-----------------------------------------------------------------------*/
+
+FRESULT f_getvsn (
+	const TCHAR* path,	/* Logical drive number */
+	DWORD* vsn			/* Pointer to a variable to store the volume serial number */
+)
+{
+	FRESULT res;
+	FATFS *fs;
+
+
+	res = find_volume(&path, &fs, 0);
+	if (res == FR_OK) {
+		res = move_window(fs, fs->volbase);
+		if (res == FR_OK) {
+			switch (fs->fs_type) {
+#if FF_FS_EXFAT
+			case FS_EXFAT:
+				*vsn = ld_dword(fs->win + BPB_VolIDEx); break;
+#endif
+			case FS_FAT32:
+				*vsn = ld_dword(fs->win + BS_VolID32); break;
+
+			default:
+				*vsn = ld_dword(fs->win + BS_VolID);
+			}
+		}
+	}
+
+	LEAVE_FF(fs, res);
+}
+
+#endif /* FF_USE_OPENAT */
+
+
+
 #if FF_USE_FORWARD
 /*-----------------------------------------------------------------------*/
 /* Forward Data to the Stream Directly                                   */
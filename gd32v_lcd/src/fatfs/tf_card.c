@@ -1,7 +1,11 @@
 #include "fatfs/tf_card.h"
+#include "fatfs/blkcache.h"
+#include <string.h>
+#include "idle.h"
 
 #define FCLK_SLOW() { SPI_CTL0(SPI1) = (SPI_CTL0(SPI1) & ~0x38) | 0x28; }	/* Set SCLK = PCLK2 / 64 */
 #define FCLK_FAST() { SPI_CTL0(SPI1) = (SPI_CTL0(SPI1) & ~0x38) | 0x00; }	/* Set SCLK = PCLK2 / 2 */
+#define FCLK_SET(psc) { SPI_CTL0(SPI1) = (SPI_CTL0(SPI1) & ~0x38) | ((psc) << 3); }	/* Set SCLK = PCLK1 / (2 << psc) */
 
 // #define FCLK_SLOW()
 // #define FCLK_FAST()
@@ -18,6 +22,7 @@
 /* MMC/SD command */
 #define CMD0	(0)			/* GO_IDLE_STATE */
 #define CMD1	(1)			/* SEND_OP_COND (MMC) */
+#define CMD6	(6)			/* SWITCH_FUNC */
 #define	ACMD41	(0x80+41)	/* SEND_OP_COND (SDC) */
 #define CMD8	(8)			/* SEND_IF_COND */
 #define CMD9	(9)			/* SEND_CSD */
@@ -29,6 +34,7 @@
 #define CMD18	(18)		/* READ_MULTIPLE_BLOCK */
 #define CMD23	(23)		/* SET_BLOCK_COUNT (MMC) */
 #define	ACMD23	(0x80+23)	/* SET_WR_BLK_ERASE_COUNT (SDC) */
+#define	ACMD51	(0x80+51)	/* SEND_SCR (SDC) */
 #define CMD24	(24)		/* WRITE_BLOCK */
 #define CMD25	(25)		/* WRITE_MULTIPLE_BLOCK */
 #define CMD32	(32)		/* ERASE_ER_BLK_START */
@@ -36,6 +42,7 @@
 #define CMD38	(38)		/* ERASE */
 #define CMD55	(55)		/* APP_CMD */
 #define CMD58	(58)		/* READ_OCR */
+#define CMD59	(59)		/* CRC_ON_OFF */
 
 static volatile
 DSTATUS Stat = STA_NOINIT;	/* Physical drive status */
@@ -61,6 +68,8 @@ void init_spi(void)
 
     rcu_periph_clock_enable(RCU_GPIOB);
     rcu_periph_clock_enable(RCU_SPI1);
+    rcu_periph_clock_enable(RCU_DMA0);		/* Sequential reads and polling, see sd_dma_start() */
+    eclic_irq_enable(DMA0_Channel3_IRQn, 1, 0);
 
     /* SPI1_SCK(PB13), SPI1_MISO(PB14) and SPI1_MOSI(PB15) GPIO pin configuration */
     gpio_init(GPIOB, GPIO_MODE_AF_PP, GPIO_OSPEED_50MHZ, GPIO_PIN_13 | GPIO_PIN_15);
@@ -111,30 +120,114 @@ void rcvr_spi_multi (
 	{
 		*buff = xchg_spi(0xff);
 		buff++;
-	} while (btr--);
+	} while (--btr);
 
 }
 
 
+/*-----------------------------------------------------------------------*/
+/* Transfer by DMA (SPI1_RX: CH3, SPI1_TX: CH4)                         */
+/*-----------------------------------------------------------------------*/
+/* While a burst is on the wire, the core sleeps in idle_wait() and the  */
+/* display's DMA interrupts go on. The receive side always runs, so its  */
+/* complete interrupt wakes us when the last byte is through, also when  */
+/* sending.                                                               */
+
+static const BYTE sd_ff = 0xFF;			/* Sent while receiving */
+static BYTE sd_sink;					/* Received while sending */
+static volatile BYTE sd_dma_done;		/* Set by the DMA interrupt */
+
+static
+void sd_dma_start (
+	BYTE *rx,		/* Receive buffer, 0: discard */
+	const BYTE *tx,	/* Transmit buffer, 0: send 0xFF */
+	UINT n			/* Bytes */
+)
+{
+	dma_parameter_struct dma_init_struct;
+
+	dma_deinit(DMA0, DMA_CH3);
+	dma_struct_para_init(&dma_init_struct);
+	dma_init_struct.periph_addr  = (uint32_t)&SPI_DATA(SPI1);
+	dma_init_struct.memory_addr  = rx ? (uint32_t)rx : (uint32_t)&sd_sink;
+	dma_init_struct.direction    = DMA_PERIPHERAL_TO_MEMORY;
+	dma_init_struct.memory_width = DMA_MEMORY_WIDTH_8BIT;
+	dma_init_struct.periph_width = DMA_PERIPHERAL_WIDTH_8BIT;
+	dma_init_struct.priority     = DMA_PRIORITY_HIGH;
+	dma_init_struct.number       = n;
+	dma_init_struct.periph_inc   = DMA_PERIPH_INCREASE_DISABLE;
+	dma_init_struct.memory_inc   = rx ? DMA_MEMORY_INCREASE_ENABLE : DMA_MEMORY_INCREASE_DISABLE;
+	dma_init(DMA0, DMA_CH3, &dma_init_struct);
+	dma_interrupt_enable(DMA0, DMA_CH3, DMA_INT_FTF);
+
+	dma_deinit(DMA0, DMA_CH4);
+	dma_init_struct.memory_addr  = tx ? (uint32_t)tx : (uint32_t)&sd_ff;
+	dma_init_struct.direction    = DMA_MEMORY_TO_PERIPHERAL;
+	dma_init_struct.priority     = DMA_PRIORITY_LOW;
+	dma_init_struct.memory_inc   = tx ? DMA_MEMORY_INCREASE_ENABLE : DMA_MEMORY_INCREASE_DISABLE;
+	dma_init(DMA0, DMA_CH4, &dma_init_struct);
+
+	sd_dma_done = 0;
+	dma_channel_enable(DMA0, DMA_CH3);
+	dma_channel_enable(DMA0, DMA_CH4);
+	spi_dma_enable(SPI1, SPI_DMA_RECEIVE);
+	spi_dma_enable(SPI1, SPI_DMA_TRANSMIT);	/* Starts the clock */
+}
+
+static
+void sd_dma_end (void)
+{
+	spi_dma_disable(SPI1, SPI_DMA_TRANSMIT);
+	spi_dma_disable(SPI1, SPI_DMA_RECEIVE);
+	dma_channel_disable(DMA0, DMA_CH4);
+	dma_channel_disable(DMA0, DMA_CH3);
+}
+
+/* Sleep until the burst is in */
+static
+int sd_dma_wait (	/* 1:Done, 0:Timeout (the transfer is stopped) */
+	UINT wt			/* Timeout [ms] */
+)
+{
+	delay_timer1 = wt;
+	while (!sd_dma_done && delay_timer1) idle_wait();
+	sd_dma_end();
+	return sd_dma_done;
+}
+
+void DMA0_Channel3_IRQHandler(void)
+{
+	if (RESET == dma_interrupt_flag_get(DMA0, DMA_CH3, DMA_INT_FLAG_FTF)) return;
+	dma_interrupt_flag_clear(DMA0, DMA_CH3, DMA_INT_FLAG_G);
+	sd_dma_done = 1;
+}
+
+
+
 /*-----------------------------------------------------------------------*/
 /* Wait for card ready                                                   */
 /*-----------------------------------------------------------------------*/
+/* A busy card holds DO low. One byte is checked directly; after that the */
+/* bus is sampled in bursts of SD_POLL_BYTES by DMA, asleep in between.  */
+/* Once the card lets DO go, it stays high: the last byte of a burst is  */
+/* enough.                                                                */
 
 static
 int wait_ready (	/* 1:Ready, 0:Timeout */
 	UINT wt			/* Timeout [ms] */
 )
 {
-	BYTE d;
+	BYTE burst[SD_POLL_BYTES];
 
-	// Timer2 = wt;
-    delay_timer2 = wt;
+	if (xchg_spi(0xFF) == 0xFF) return 1;	/* Ready: the usual case */
+	delay_timer2 = wt;
 	do {
-		d = xchg_spi(0xFF);
-		/* This loop takes a time. Insert rot_rdq() here for multitask envilonment. */
-	} while (d != 0xFF && delay_timer2);	/* Wait for card goes ready or timeout */
+		sd_dma_start(burst, 0, SD_POLL_BYTES);
+		if (!sd_dma_wait(10)) return 0;
+		if (burst[SD_POLL_BYTES - 1] == 0xFF) return 1;
+	} while (delay_timer2);		/* Wait for card goes ready or timeout */
 
-	return (d == 0xFF) ? 1 : 0;
+	return 0;
 }
 
 
@@ -169,30 +262,192 @@ int _select (void)	/* 1:OK, 0:Timeout */
 
 
 
+/*-----------------------------------------------------------------------*/
+/* CRC of commands (CRC7) and data packets (CRC16)                       */
+/*-----------------------------------------------------------------------*/
+/* The card checks them only after CMD59 (SD_CRC in tf_card.h). Command  */
+/* CRCs are always sent correctly, so CMD0 and CMD8 need no special      */
+/* case. Table-driven: the SPI's own CRC unit cannot follow the DMA      */
+/* stream across the start tokens.                                       */
+
+static BYTE crc_on;				/* Card checks CRCs, and so do we */
+static BYTE crc_bad;			/* Last transfer failed a CRC check */
+static SdErrStats sd_err;
+
+static
+BYTE crc7 (		/* CRC7 in bits 7..1, end bit set */
+	const BYTE *p,
+	UINT n
+)
+{
+	BYTE crc = 0, i;
+
+	while (n--) {
+		crc ^= *p++;
+		for (i = 0; i < 8; i++) crc = (crc & 0x80) ? (crc << 1) ^ 0x12 : crc << 1;
+	}
+	return crc | 1;
+}
+
+static const WORD crc16_tab[256] = {	/* CRC-16/CCITT (x^16+x^12+x^5+1), as in the data packets */
+	0x0000, 0x1021, 0x2042, 0x3063, 0x4084, 0x50A5, 0x60C6, 0x70E7,
+	0x8108, 0x9129, 0xA14A, 0xB16B, 0xC18C, 0xD1AD, 0xE1CE, 0xF1EF,
+	0x1231, 0x0210, 0x3273, 0x2252, 0x52B5, 0x4294, 0x72F7, 0x62D6,
+	0x9339, 0x8318, 0xB37B, 0xA35A, 0xD3BD, 0xC39C, 0xF3FF, 0xE3DE,
+	0x2462, 0x3443, 0x0420, 0x1401, 0x64E6, 0x74C7, 0x44A4, 0x5485,
+	0xA56A, 0xB54B, 0x8528, 0x9509, 0xE5EE, 0xF5CF, 0xC5AC, 0xD58D,
+	0x3653, 0x2672, 0x1611, 0x0630, 0x76D7, 0x66F6, 0x5695, 0x46B4,
+	0xB75B, 0xA77A, 0x9719, 0x8738, 0xF7DF, 0xE7FE, 0xD79D, 0xC7BC,
+	0x48C4, 0x58E5, 0x6886, 0x78A7, 0x0840, 0x1861, 0x2802, 0x3823,
+	0xC9CC, 0xD9ED, 0xE98E, 0xF9AF, 0x8948, 0x9969, 0xA90A, 0xB92B,
+	0x5AF5, 0x4AD4, 0x7AB7, 0x6A96, 0x1A71, 0x0A50, 0x3A33, 0x2A12,
+	0xDBFD, 0xCBDC, 0xFBBF, 0xEB9E, 0x9B79, 0x8B58, 0xBB3B, 0xAB1A,
+	0x6CA6, 0x7C87, 0x4CE4, 0x5CC5, 0x2C22, 0x3C03, 0x0C60, 0x1C41,
+	0xEDAE, 0xFD8F, 0xCDEC, 0xDDCD, 0xAD2A, 0xBD0B, 0x8D68, 0x9D49,
+	0x7E97, 0x6EB6, 0x5ED5, 0x4EF4, 0x3E13, 0x2E32, 0x1E51, 0x0E70,
+	0xFF9F, 0xEFBE, 0xDFDD, 0xCFFC, 0xBF1B, 0xAF3A, 0x9F59, 0x8F78,
+	0x9188, 0x81A9, 0xB1CA, 0xA1EB, 0xD10C, 0xC12D, 0xF14E, 0xE16F,
+	0x1080, 0x00A1, 0x30C2, 0x20E3, 0x5004, 0x4025, 0x7046, 0x6067,
+	0x83B9, 0x9398, 0xA3FB, 0xB3DA, 0xC33D, 0xD31C, 0xE37F, 0xF35E,
+	0x02B1, 0x1290, 0x22F3, 0x32D2, 0x4235, 0x5214, 0x6277, 0x7256,
+	0xB5EA, 0xA5CB, 0x95A8, 0x8589, 0xF56E, 0xE54F, 0xD52C, 0xC50D,
+	0x34E2, 0x24C3, 0x14A0, 0x0481, 0x7466, 0x6447, 0x5424, 0x4405,
+	0xA7DB, 0xB7FA, 0x8799, 0x97B8, 0xE75F, 0xF77E, 0xC71D, 0xD73C,
+	0x26D3, 0x36F2, 0x0691, 0x16B0, 0x6657, 0x7676, 0x4615, 0x5634,
+	0xD94C, 0xC96D, 0xF90E, 0xE92F, 0x99C8, 0x89E9, 0xB98A, 0xA9AB,
+	0x5844, 0x4865, 0x7806, 0x6827, 0x18C0, 0x08E1, 0x3882, 0x28A3,
+	0xCB7D, 0xDB5C, 0xEB3F, 0xFB1E, 0x8BF9, 0x9BD8, 0xABBB, 0xBB9A,
+	0x4A75, 0x5A54, 0x6A37, 0x7A16, 0x0AF1, 0x1AD0, 0x2AB3, 0x3A92,
+	0xFD2E, 0xED0F, 0xDD6C, 0xCD4D, 0xBDAA, 0xAD8B, 0x9DE8, 0x8DC9,
+	0x7C26, 0x6C07, 0x5C64, 0x4C45, 0x3CA2, 0x2C83, 0x1CE0, 0x0CC1,
+	0xEF1F, 0xFF3E, 0xCF5D, 0xDF7C, 0xAF9B, 0xBFBA, 0x8FD9, 0x9FF8,
+	0x6E17, 0x7E36, 0x4E55, 0x5E74, 0x2E93, 0x3EB2, 0x0ED1, 0x1EF0
+};
+
+static
+WORD crc16 (
+	const BYTE *p,
+	UINT n
+)
+{
+	WORD crc = 0;
+
+	while (n--) crc = (WORD)(crc << 8) ^ crc16_tab[(BYTE)(crc >> 8) ^ *p++];
+	return crc;
+}
+
+
+/* Check the CRC16 that follows a data block */
+static
+int crc_check (		/* 1:OK (or not checking) */
+	const BYTE *buff,
+	UINT btr,
+	WORD crc		/* As received */
+)
+{
+	if (!crc_on || crc16(buff, btr) == crc) return 1;
+	sd_err.crc_data++;
+	crc_bad = 1;
+	return 0;
+}
+
+
 /*-----------------------------------------------------------------------*/
 /* Receive a data packet from the MMC                                    */
 /*-----------------------------------------------------------------------*/
 
+/* Wait for the DataStart token. Sector sized blocks are polled in DMA    */
+/* bursts; the bytes that came in behind the token are the first data    */
+/* bytes and are moved to the buffer. Short blocks (CSD, SCR) are polled */
+/* byte by byte, a burst could run past their CRC.                        */
+static
+int rcvr_token (	/* Data bytes stored already, -1:Timeout or error token */
+	BYTE *buff,		/* Data buffer */
+	UINT btr,		/* Data block length (byte) */
+	UINT wt			/* Timeout [ms] */
+)
+{
+	BYTE token, burst[SD_POLL_BYTES];
+	UINT i;
+
+	token = xchg_spi(0xFF);
+	if (token == 0xFF && btr >= 2 * SD_POLL_BYTES) {
+		delay_timer2 = wt;
+		do {
+			sd_dma_start(burst, 0, SD_POLL_BYTES);
+			if (!sd_dma_wait(10)) return -1;
+			for (i = 0; i < SD_POLL_BYTES && burst[i] == 0xFF; i++) ;
+		} while (i == SD_POLL_BYTES && delay_timer2);
+		if (i == SD_POLL_BYTES || burst[i] != 0xFE) return -1;
+		memcpy(buff, burst + i + 1, SD_POLL_BYTES - 1 - i);
+		return SD_POLL_BYTES - 1 - i;
+	}
+	delay_timer2 = wt;
+	while (token == 0xFF && delay_timer2) token = xchg_spi(0xFF);
+	return (token == 0xFE) ? 0 : -1;
+}
+
+
 static
 int rcvr_datablock (	/* 1:OK, 0:Error */
 	BYTE *buff,			/* Data buffer */
 	UINT btr			/* Data block length (byte) */
 )
 {
-	BYTE token;
+	WORD crc;
+	int n;
 
-	delay_timer1 = 200;
-	do {							/* Wait for DataStart token in timeout of 200ms */
-		token = xchg_spi(0xFF);
-		/* This loop will take a time. Insert rot_rdq() here for multitask envilonment. */
-	} while ((token == 0xFF) && delay_timer1);
-	if(token != 0xFE) return 0;		/* Function fails if invalid DataStart token or timeout */
+	n = rcvr_token(buff, btr, 200);	/* Wait for DataStart token in timeout of 200ms */
+	if (n < 0) return 0;			/* Function fails if invalid DataStart token or timeout */
 
-	rcvr_spi_multi(buff, btr);		/* Store trailing data to the buffer */
-	xchg_spi(0xFF); xchg_spi(0xFF);			/* Discard CRC */
+	if (btr - n >= SD_POLL_BYTES) {	/* Store trailing data to the buffer */
+		sd_dma_start(buff + n, 0, btr - n);
+		if (!sd_dma_wait(200)) return 0;
+	} else if (btr > (UINT)n) {
+		rcvr_spi_multi(buff + n, btr - n);
+	}
+	crc = xchg_spi(0xFF) << 8;		/* CRC16 */
+	crc |= xchg_spi(0xFF);
+
+	return crc_check(buff, btr, crc);
+}
+
+
+/*-----------------------------------------------------------------------*/
+/* Send a data packet to the MMC                                         */
+/*-----------------------------------------------------------------------*/
+
+#if FF_FS_READONLY == 0
+static
+int xmit_datablock (	/* 1:OK, 0:Failed */
+	const BYTE *buff,	/* Ponter to 512 byte data to be sent */
+	BYTE token			/* Token */
+)
+{
+	BYTE resp;
+	WORD crc;
+
+
+	if (!wait_ready(500)) return 0;		/* Wait for card ready */
 
-	return 1;						/* Function succeeded */
+	xchg_spi(token);					/* Send token */
+	if (token != 0xFD) {				/* Send data if token is other than StopTran */
+		crc = crc_on ? crc16(buff, 512) : 0xFFFF;	/* Card checks it after CMD59 */
+		sd_dma_start(0, buff, 512);		/* Data */
+		if (!sd_dma_wait(200)) return 0;
+		xchg_spi((BYTE)(crc >> 8));
+		xchg_spi((BYTE)crc);
+
+		resp = xchg_spi(0xFF);			/* Receive data resp */
+		if ((resp & 0x1F) == 0x0B) {	/* Rejected for its CRC */
+			sd_err.crc_data++;
+			crc_bad = 1;
+		}
+		if ((resp & 0x1F) != 0x05) return 0;	/* Function fails if the data packet was not accepted */
+	}
+	return 1;
 }
+#endif
 
 
 /*-----------------------------------------------------------------------*/
@@ -205,7 +460,7 @@ BYTE send_cmd (		/* Return value: R1 resp (bit7==1:Failed to send) */
 	DWORD arg		/* Argument */
 )
 {
-	BYTE n, res;
+	BYTE n, res, pkt[5];
 
 
 	if (cmd & 0x80) {	/* Send a CMD55 prior to ACMD<n> */
@@ -221,15 +476,13 @@ BYTE send_cmd (		/* Return value: R1 resp (bit7==1:Failed to send) */
 	}
 
 	/* Send command packet */
-	xchg_spi(0x40 | cmd);				/* Start + command index */
-	xchg_spi((BYTE)(arg >> 24));		/* Argument[31..24] */
-	xchg_spi((BYTE)(arg >> 16));		/* Argument[23..16] */
-	xchg_spi((BYTE)(arg >> 8));			/* Argument[15..8] */
-	xchg_spi((BYTE)arg);				/* Argument[7..0] */
-	n = 0x01;							/* Dummy CRC + Stop */
-	if (cmd == CMD0) n = 0x95;			/* Valid CRC for CMD0(0) */
-	if (cmd == CMD8) n = 0x87;			/* Valid CRC for CMD8(0x1AA) */
-	xchg_spi(n);
+	pkt[0] = 0x40 | cmd;				/* Start + command index */
+	pkt[1] = (BYTE)(arg >> 24);			/* Argument[31..24] */
+	pkt[2] = (BYTE)(arg >> 16);			/* Argument[23..16] */
+	pkt[3] = (BYTE)(arg >> 8);			/* Argument[15..8] */
+	pkt[4] = (BYTE)arg;					/* Argument[7..0] */
+	for (n = 0; n < 5; n++) xchg_spi(pkt[n]);
+	xchg_spi(crc7(pkt, 5));				/* CRC + Stop */
 
 	/* Receive command resp */
 	if (cmd == CMD12) xchg_spi(0xFF);	/* Diacard following one byte when CMD12 */
@@ -237,134 +490,361 @@ BYTE send_cmd (		/* Return value: R1 resp (bit7==1:Failed to send) */
 	do {
 		res = xchg_spi(0xFF);
 	} while ((res & 0x80) && --n);
+	if (!(res & 0x80) && (res & 0x08)) {	/* Command CRC error */
+		sd_err.crc_cmd++;
+		crc_bad = 1;
+	}
 
 	return res;							/* Return received response */
 }
 
+/*-----------------------------------------------------------------------*/
+/* Sequential read stream                                                */
+/*-----------------------------------------------------------------------*/
+/* A read that starts where the last one ended opens a multiple block    */
+/* read (CMD18) and leaves it running. The card's blocks are received by */
+/* DMA into a ring of STRM_SLOTS sectors, one block in flight at a time, */
+/* so the next reads are served from RAM. disk_prefetch() keeps the ring */
+/* filling between reads. The stream is stopped with CMD12 only when a   */
+/* read goes elsewhere, or for any other command.                        */
+
+static BYTE strm_buf[STRM_SLOTS][512];
+static BYTE strm_open;				/* CMD18 running, card selected */
+static BYTE strm_dma;				/* Block in flight into slot (strm_head + strm_count) */
+static BYTE strm_head, strm_count;	/* Ring: oldest filled slot, filled slots */
+static DWORD strm_sector;			/* Sector in the oldest slot */
+static DWORD strm_last = 0xFFFFFFFF;	/* Sector after the last read */
+
+/* Move the stream on by one step. wait=0: only what is ready now */
 static
-void init_timer2(void)
-{
-    timer_parameter_struct timer_initpara;
-
-    rcu_periph_clock_enable(RCU_TIMER2);
-    timer_deinit(TIMER2);
-    /* ((1+TIM_Prescaler )/时钟)*(1+TIM_Period ) 
-        (108000/108000000)*(1000)=1ms
-    */
-    timer_initpara.period = (1000 - 1);
-    timer_initpara.prescaler         = (108 - 1);
-    timer_initpara.alignedmode       = TIMER_COUNTER_EDGE;
-    timer_initpara.counterdirection  = TIMER_COUNTER_UP;
-    timer_initpara.clockdivision     = TIMER_CKDIV_DIV1;
-    timer_initpara.repetitioncounter = 0;
-    timer_init(TIMER2, &timer_initpara);
-
-    timer_update_event_enable(TIMER2);
-    timer_interrupt_enable(TIMER2,TIMER_INT_UP);
-    timer_flag_clear(TIMER2, TIMER_FLAG_UP);
-    timer_update_source_config(TIMER2, TIMER_UPDATE_SRC_GLOBAL);
-
-    /* TIMER2 counter enable */
-    timer_enable(TIMER2);
-}
-
-/*!
-    \brief      time base IRQ
-    \param[in]  none
-    \param[out] none
-    \retval     none
-*/
+int strm_fill (		/* 1:OK, 0:Error */
+	int wait
+)
+{
+	BYTE token, *slot;
+	WORD crc;
+	int n;
+
+	if (strm_dma) {					/* Block in flight: done? */
+		if (!wait && !sd_dma_done) return 1;
+		if (!sd_dma_wait(200)) {
+			strm_dma = 0;
+			return 0;
+		}
+		crc = xchg_spi(0xFF) << 8;
+		crc |= xchg_spi(0xFF);
+		strm_dma = 0;
+		if (!crc_check(strm_buf[(strm_head + strm_count) % STRM_SLOTS], 512, crc)) return 0;
+		strm_count++;
+		return 1;
+	}
+	if (strm_count == STRM_SLOTS) return 1;	/* Ring full: the card waits for clocks */
+
+	slot = strm_buf[(strm_head + strm_count) % STRM_SLOTS];
+	if (wait) {
+		n = rcvr_token(slot, 512, 200);
+		if (n < 0) return 0;
+	} else {
+		n = 8;						/* Without wait: a few bytes for the token */
+		do {
+			token = xchg_spi(0xFF);
+		} while (token == 0xFF && --n);
+		if (token == 0xFF) return 1;
+		if (token != 0xFE) return 0;	/* Error token */
+		n = 0;						/* The whole block is still to come */
+	}
+	sd_dma_start(slot + n, 0, 512 - n);
+	strm_dma = 1;
+	return 1;
+}
+
+/* End the multiple block read */
 static
-void tfcard_timer_irq (void)
+void strm_stop (void)
 {
-    if (RESET != timer_flag_get(TIMER2, TIMER_FLAG_UP)){
-        timer_flag_clear(TIMER2, TIMER_FLAG_UP);
+	if (!strm_open) return;
+	if (strm_dma) strm_fill(1);		/* Let the block in flight finish */
+	strm_dma = 0;
+	send_cmd(CMD12, 0);				/* STOP_TRANSMISSION */
+	deselect();
+	strm_open = 0;
+	strm_count = 0;
+}
 
-        if (delay_timer1 > 0x00U){
-            delay_timer1--;
-        }
-        if (delay_timer2 > 0x00U){
-            delay_timer2--;
-        }
-        // else {
-        //     timer_disable(TIMER2);
-        // }
-    }
+/* Move the stream on without waiting. On an error the stream is closed: */
+/* the ring would hold the next block in the failed sector's slot, so    */
+/* the next read starts over with a new command. */
+static
+int strm_poll (void)		/* 1:OK, 0:Error */
+{
+	if (strm_fill(0)) return 1;
+	strm_stop();
+	strm_last = 0xFFFFFFFF;
+	return 0;
 }
 
-/*!
-    \brief      this function handles Timer0 updata interrupt request.
-    \param[in]  none
-    \param[out] none
-    \retval     none
-*/
-void TIMER2_IRQHandler(void)
+/* Read sectors from the stream, opening it if needed */
+static
+DRESULT strm_read (
+	BYTE *buff,
+	DWORD sector,
+	UINT count
+)
 {
-    // tfcard_timer_irq();
+	if (!strm_open) {
+		if (send_cmd(CMD18, (CardType & CT_BLOCK) ? sector : sector * 512) != 0) {
+			deselect();
+			return RES_ERROR;
+		}
+		strm_open = 1;
+		strm_head = strm_count = 0;
+		strm_sector = sector;
+	}
+	while (count) {
+		while (!strm_count) {
+			if (!strm_fill(1)) {
+				strm_stop();
+				strm_last = 0xFFFFFFFF;
+				return RES_ERROR;
+			}
+		}
+		memcpy(buff, strm_buf[strm_head], 512);
+		strm_head = (strm_head + 1) % STRM_SLOTS;
+		strm_count--;
+		strm_sector++;
+		buff += 512;
+		count--;
+		if (!strm_poll()) return count ? RES_ERROR : RES_OK;	/* Keep the card busy */
+	}
+	if (strm_poll()) strm_last = strm_sector;
+	return RES_OK;
 }
 
 
-/*--------------------------------------------------------------------------
+/*-----------------------------------------------------------------------*/
+/* Bus speed: card capabilities, high-speed mode, prescaler search       */
+/*-----------------------------------------------------------------------*/
+/* After init, the CSD tells the card's top clock (TRAN_SPEED, 25MHz for */
+/* SD cards). SD cards from spec 1.10 on may switch to high-speed mode   */
+/* (CMD6, 50MHz). Then the prescalers are tried from the fastest one the */
+/* card allows down: the first that reads sector 0 with a good CRC16     */
+/* stays. If none does, the init clock (PCLK1/64) is kept.              */
 
-   Public Functions
+static DWORD spi_hz;			/* SPI clock chosen by probe_speed() */
 
----------------------------------------------------------------------------*/
+/* CSD TRAN_SPEED to Hz */
+static
+DWORD tran_speed (
+	BYTE ts
+)
+{
+	static const BYTE mult[16] = { 0, 10, 12, 13, 15, 20, 25, 30, 35, 40, 45, 50, 55, 60, 70, 80 };
+	DWORD hz = 10000;				/* Unit 0 is 100kbit/s, mult is x10 */
+	BYTE u = ts & 7;
+
+	while (u--) hz *= 10;
+	return hz * mult[(ts >> 3) & 15];
+}
+
+/* Switch an SD card into high-speed mode */
+static
+int switch_hs (		/* 1:Card runs in high-speed mode */
+	BYTE *buf		/* 64 bytes of scratch */
+)
+{
+	if (!(CardType & CT_SD2)) return 0;
+	if (send_cmd(ACMD51, 0) != 0 || !rcvr_datablock(buf, 8)) return 0;	/* Read SCR */
+	if ((buf[0] & 0x0F) < 1) return 0;			/* SD_SPEC: CMD6 needs 1.10 or later */
+	if (send_cmd(CMD6, 0x00FFFFF1) != 0 || !rcvr_datablock(buf, 64)) return 0;	/* Check function 1 of group 1 */
+	if (!(buf[13] & 0x02)) return 0;			/* High-speed not supported */
+	if (send_cmd(CMD6, 0x80FFFFF1) != 0 || !rcvr_datablock(buf, 64)) return 0;	/* Switch */
+	return (buf[16] & 0x0F) == 1;				/* Group 1 now runs function 1 */
+}
+
+/* Read sector 0 and check its CRC16 */
+static
+int test_read (		/* 1:OK, 0:Error or bad CRC */
+	BYTE *buf		/* 512 bytes */
+)
+{
+	WORD crc;
+	int ok = 0, n;
+
+	if (send_cmd(CMD17, 0) == 0) {
+		n = rcvr_token(buf, 512, 200);
+		if (n >= 0) {
+			rcvr_spi_multi(buf + n, 512 - n);
+			crc = xchg_spi(0xFF) << 8;
+			crc |= xchg_spi(0xFF);
+			ok = (crc16(buf, 512) == crc);
+		}
+	}
+	deselect();
+	return ok;
+}
+
+static
+void probe_speed (void)
+{
+	BYTE csd[16], *buf = strm_buf[0];	/* No stream yet: borrow its ring */
+	DWORD pclk = rcu_clock_freq_get(CK_APB1), max = 25000000;
+	BYTE psc;
+
+#if SD_CRC
+	if (send_cmd(CMD59, 1) == 0) crc_on = 1;	/* CRC checks on */
+#endif
+	if (send_cmd(CMD9, 0) == 0 && rcvr_datablock(csd, 16)) max = tran_speed(csd[3]);
+	if (switch_hs(buf)) {
+		CardType |= CT_HS;
+		xchg_spi(0xFF);						/* 8 clocks, then the new timing is active */
+		if (send_cmd(CMD9, 0) == 0 && rcvr_datablock(csd, 16)) max = tran_speed(csd[3]);
+	}
+	deselect();
+
+	for (psc = 0; psc < 5; psc++) {		/* PCLK1/2 .. PCLK1/32 */
+		if ((pclk >> (psc + 1)) > max) continue;
+		FCLK_SET(psc);
+		if (test_read(buf)) break;
+	}
+	if (psc == 5) FCLK_SLOW();			/* Nothing passed: init clock */
+	spi_hz = pclk >> (psc + 1);
+}
 
 
 /*-----------------------------------------------------------------------*/
-/* Initialize disk drive                                                 */
+/* 1ms timer tick (called from the systick interrupt)                    */
 /*-----------------------------------------------------------------------*/
 
-DSTATUS disk_initialize (
-	BYTE drv		/* Physical drive number (0) */
-)
+void disk_timerproc (void)
 {
-	BYTE n, cmd, ty, ocr[4];
+	UINT n;
 
+	n = delay_timer1;						/* 1kHz decrement timer stopped at 0 */
+	if (n) delay_timer1 = --n;
+	n = delay_timer2;
+	if (n) delay_timer2 = --n;
+}
 
-	if (drv) return STA_NOINIT;			/* Supports only drive 0 */
-	init_spi();							/* Initialize SPI */
-    delay_1ms(10);
-    init_timer2();
 
-	if (Stat & STA_NODISK) return Stat;	/* Is card existing in the soket? */
+/*--------------------------------------------------------------------------
+
+   Public Functions
 
-	FCLK_SLOW();
-	CS_LOW();
-	for (n = 10; n; n--) xchg_spi(0xFF);	/* Send 80 dummy clocks */
+---------------------------------------------------------------------------*/
 
-	ty = 0;
-	if (send_cmd(CMD0, 0) == 1) {			/* Put the card SPI/Idle state */
-		delay_timer1 = 1000;						/* Initialization timeout = 1 sec */
+
+/*-----------------------------------------------------------------------*/
+/* Card initialization state machine                                     */
+/*-----------------------------------------------------------------------*/
+/* disk_init_step() does one small piece of the card initialization per   */
+/* call: power-up wait, CMD0/CMD8, or a single ACMD41/CMD1 poll. Timeouts */
+/* run on the mtime counter. Call it until it returns 0, then check       */
+/* disk_status(). disk_initialize() uses it, too.                         */
+
+enum { SDI_START, SDI_POWER, SDI_V2_WAIT, SDI_V1_WAIT, SDI_DONE };
+static BYTE sdi_state = SDI_START;
+static BYTE sdi_cmd;				/* Init command for SDv1/MMC */
+static uint64_t sdi_until;			/* mtime: end of the wait or timeout */
+
+#define MTIME_MS(ms)	((uint64_t)SystemCoreClock / 4000 * (ms))
+
+static DRESULT mmc_read (BYTE *buff, DWORD sector, UINT count);
+
+int disk_init_step (void)	/* 1:Busy, 0:Finished */
+{
+	BYTE n, ty = 0, ocr[4];
+
+
+	switch (sdi_state) {
+	case SDI_START:
+		init_spi();							/* Initialize SPI */
+		systick_add_hook(disk_timerproc);	/* Timeouts need the 1ms tick (systick_init) */
+		blkcache_init(mmc_read);			/* Maybe another card: forget the old sectors */
+		strm_open = strm_dma = 0;			/* The card forgets its CMD18 */
+		crc_on = 0;							/* ...and CMD59 */
+		memset(&sd_err, 0, sizeof sd_err);
+		strm_last = 0xFFFFFFFF;
+		sdi_until = get_timer_value() + MTIME_MS(10);	/* Power-up time */
+		sdi_state = SDI_POWER;
+		return 1;
+
+	case SDI_POWER:
+		if (get_timer_value() < sdi_until) return 1;
+		if (Stat & STA_NODISK) break;		/* Is card existing in the soket? */
+		FCLK_SLOW();
+		CS_LOW();
+		for (n = 10; n; n--) xchg_spi(0xFF);	/* Send 80 dummy clocks */
+		if (send_cmd(CMD0, 0) != 1) break;		/* Put the card SPI/Idle state */
+		sdi_until = get_timer_value() + MTIME_MS(1000);	/* Initialization timeout = 1 sec */
 		if (send_cmd(CMD8, 0x1AA) == 1) {	/* SDv2? */
 			for (n = 0; n < 4; n++) ocr[n] = xchg_spi(0xFF);	/* Get 32 bit return value of R7 resp */
-			if (ocr[2] == 0x01 && ocr[3] == 0xAA) {				/* Is the card supports vcc of 2.7-3.6V? */
-				while (delay_timer1 && send_cmd(ACMD41, 1UL << 30)) ;	/* Wait for end of initialization with ACMD41(HCS) */
-				if (delay_timer1 && send_cmd(CMD58, 0) == 0) {		/* Check CCS bit in the OCR */
-					for (n = 0; n < 4; n++) ocr[n] = xchg_spi(0xFF);
-					ty = (ocr[0] & 0x40) ? CT_SD2 | CT_BLOCK : CT_SD2;	/* Card id SDv2 */
-				}
-			}
+			if (ocr[2] != 0x01 || ocr[3] != 0xAA) break;		/* Is the card supports vcc of 2.7-3.6V? */
+			sdi_state = SDI_V2_WAIT;
 		} else {	/* Not SDv2 card */
 			if (send_cmd(ACMD41, 0) <= 1) 	{	/* SDv1 or MMC? */
-				ty = CT_SD1; cmd = ACMD41;	/* SDv1 (ACMD41(0)) */
+				CardType = CT_SD1; sdi_cmd = ACMD41;	/* SDv1 (ACMD41(0)) */
 			} else {
-				ty = CT_MMC; cmd = CMD1;	/* MMCv3 (CMD1(0)) */
+				CardType = CT_MMC; sdi_cmd = CMD1;	/* MMCv3 (CMD1(0)) */
 			}
-			while (delay_timer1 && send_cmd(cmd, 0)) ;		/* Wait for end of initialization */
-			if (!delay_timer1 || send_cmd(CMD16, 512) != 0)	/* Set block length: 512 */
-				ty = 0;
+			sdi_state = SDI_V1_WAIT;
 		}
+		return 1;
+
+	case SDI_V2_WAIT:	/* Wait for end of initialization with ACMD41(HCS) */
+		if (send_cmd(ACMD41, 1UL << 30)) {
+			if (get_timer_value() < sdi_until) return 1;
+			break;							/* Timeout */
+		}
+		if (send_cmd(CMD58, 0) == 0) {		/* Check CCS bit in the OCR */
+			for (n = 0; n < 4; n++) ocr[n] = xchg_spi(0xFF);
+			ty = (ocr[0] & 0x40) ? CT_SD2 | CT_BLOCK : CT_SD2;	/* Card id SDv2 */
+		}
+		break;
+
+	case SDI_V1_WAIT:	/* Wait for end of initialization */
+		if (send_cmd(sdi_cmd, 0)) {
+			if (get_timer_value() < sdi_until) return 1;
+			break;							/* Timeout */
+		}
+		if (send_cmd(CMD16, 512) == 0)		/* Set block length: 512 */
+			ty = CardType;
+		break;
+
+	default:
+		return 0;
 	}
+
+	/* Finished, one way or the other */
 	CardType = ty;	/* Card type */
 	deselect();
 
 	if (ty) {			/* OK */
-		FCLK_FAST();			/* Set fast clock */
+		probe_speed();			/* Set the fastest clock that works */
 		Stat &= ~STA_NOINIT;	/* Clear STA_NOINIT flag */
 	} else {			/* Failed */
 		Stat = STA_NOINIT;
 	}
+	sdi_state = SDI_DONE;
+	return 0;
+}
+
+
+
+/*-----------------------------------------------------------------------*/
+/* Initialize disk drive                                                 */
+/*-----------------------------------------------------------------------*/
+
+DSTATUS disk_initialize (
+	BYTE drv		/* Physical drive number (0) */
+)
+{
+	if (drv) return STA_NOINIT;			/* Supports only drive 0 */
+
+	/* Already brought up by disk_init_step() calls? */
+	if (sdi_state == SDI_DONE && !(Stat & STA_NOINIT)) return Stat;
+
+	sdi_state = SDI_START;				/* (Re)start and run to the end */
+	while (disk_init_step()) ;
 
 	return Stat;
 }
@@ -390,15 +870,18 @@ DSTATUS disk_status (
 /* Read sector(s)                                                        */
 /*-----------------------------------------------------------------------*/
 
-DRESULT disk_read (
-	BYTE drv,		/* Physical drive number (0) */
+static
+DRESULT mmc_read_once (
 	BYTE *buff,		/* Pointer to the data buffer to store read data */
 	DWORD sector,	/* Start sector number (LBA) */
 	UINT count		/* Number of sectors to read (1..128) */
 )
 {
-	if (drv || !count) return RES_PARERR;		/* Check parameter */
-	if (Stat & STA_NOINIT) return RES_NOTRDY;	/* Check if drive is ready */
+	if (strm_open ? sector == strm_sector : sector == strm_last) {
+		return strm_read(buff, sector, count);	/* Sequential: stream */
+	}
+	strm_stop();
+	strm_last = sector + count;
 
 	if (!(CardType & CT_BLOCK)) sector *= 512;	/* LBA ot BA conversion (byte addressing cards) */
 
@@ -423,6 +906,77 @@ DRESULT disk_read (
 }
 
 
+/* Lower the SPI clock one step, but not below PCLK1/32 */
+static
+void clk_down (void)
+{
+	BYTE psc = (SPI_CTL0(SPI1) >> 3) & 7;
+
+	if (psc >= 4) return;
+	psc++;
+	FCLK_SET(psc);
+	spi_hz = rcu_clock_freq_get(CK_APB1) >> (psc + 1);
+	sd_err.slowdowns++;
+}
+
+static
+DRESULT mmc_read (	/* Card access behind the sector cache: with retries */
+	BYTE *buff,		/* Pointer to the data buffer to store read data */
+	DWORD sector,	/* Start sector number (LBA) */
+	UINT count		/* Number of sectors to read (1..128) */
+)
+{
+	BYTE n = SD_RETRIES;
+	DRESULT res;
+
+	for (;;) {
+		crc_bad = 0;
+		res = mmc_read_once(buff, sector, count);
+		if (res == RES_OK) return RES_OK;
+		if (!n--) break;
+		sd_err.retries++;
+		if (crc_bad) clk_down();		/* The link is too fast */
+	}
+	sd_err.failed++;
+	return res;
+}
+
+
+DRESULT disk_read (
+	BYTE drv,		/* Physical drive number (0) */
+	BYTE *buff,		/* Pointer to the data buffer to store read data */
+	DWORD sector,	/* Start sector number (LBA) */
+	UINT count		/* Number of sectors to read (1..128) */
+)
+{
+	if (drv || !count) return RES_PARERR;		/* Check parameter */
+	if (Stat & STA_NOINIT) return RES_NOTRDY;	/* Check if drive is ready */
+
+	return blkcache_read(buff, sector, count);	/* See blkcache.c */
+}
+
+
+/* Read errors since init */
+const SdErrStats *disk_err_stats (void)
+{
+	return &sd_err;
+}
+
+
+/* SPI clock picked by probe_speed() at init, lowered on CRC errors */
+DWORD disk_spi_clock (void)
+{
+	return spi_hz;
+}
+
+
+/* Receive the next stream block if the card has it ready. Call while idle. */
+void disk_prefetch (void)
+{
+	if (strm_open && !(Stat & STA_NOINIT)) strm_poll();
+}
+
+
 
 /*-----------------------------------------------------------------------*/
 /* Write sector(s)                                                       */
@@ -439,6 +993,10 @@ DRESULT disk_write (
 	if (drv || !count) return RES_PARERR;		/* Check parameter */
 	if (Stat & STA_NOINIT) return RES_NOTRDY;	/* Check drive status */
 	if (Stat & STA_PROTECT) return RES_WRPRT;	/* Check write protect */
+	strm_stop();
+	strm_last = 0xFFFFFFFF;
+
+	blkcache_invalidate(sector, count);			/* Cached copies are old now */
 
 	if (!(CardType & CT_BLOCK)) sector *= 512;	/* LBA ==> BA conversion (byte addressing cards) */
 
@@ -449,7 +1007,7 @@ DRESULT disk_write (
 		}
 	}
 	else {				/* Multiple sector write */
-		if (CardType & CT_SDC) send_cmd(ACMD23, count);	/* Predefine number of sectors */
+		if (CardType & CT_SDC) send_cmd(ACMD23, count);	/* Pre-erase: the card may erase all blocks at once */
 		if (send_cmd(CMD25, sector) == 0) {	/* WRITE_MULTIPLE_BLOCK */
 			do {
 				if (!xmit_datablock(buff, 0xFC)) break;
@@ -483,9 +1041,16 @@ DRESULT disk_ioctl (
 	if (drv) return RES_PARERR;					/* Check parameter */
 	if (Stat & STA_NOINIT) return RES_NOTRDY;	/* Check if drive is ready */
 
+	strm_stop();								/* Other commands end the stream */
+	strm_last = 0xFFFFFFFF;
 	res = RES_ERROR;
 
 	switch (cmd) {
+	case MMC_GET_TYPE :		/* Get card type flags (1 byte) */
+		*(BYTE*)buff = CardType;
+		res = RES_OK;
+		break;
+
 	case CTRL_SYNC :		/* Wait for end of internal write process of the drive */
 		if (_select()) res = RES_OK;
 		break;
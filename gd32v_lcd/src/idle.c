@@ -0,0 +1,60 @@
+/**************************************************************************
+ * Idle and sleep accounting
+ * Code CC-BY untergeekDE
+ *
+ * Waiting loops call idle_wait() instead of spinning: WFI stops the core
+ * clock until the next interrupt (1ms tick, DMA complete). The mtime
+ * counter keeps running, so the time spent asleep is simply the mtime
+ * difference around the WFI. The tick interrupt closes the books once
+ * a second.
+ * (The interrupt that wakes us runs before the WFI returns, so its time
+ * is counted as idle. A few microseconds per tick.)
+ * *******************************************************************************/
+
+#include "gd32vf103.h"
+#include "n200_func.h"
+#include "systick.h"
+#include "idle.h"
+
+static uint32_t idle_ticks;			// mtime ticks asleep; only written here, wraps
+static uint32_t idle_snap;			// idle_ticks at the start of the second
+static volatile uint32_t idle_last;	// Ticks asleep in the last full second
+static uint16_t idle_ms;
+
+// 1ms tick hook: once a second, take the difference
+static void idle_tick(void)
+{
+	if (++idle_ms < 1000) return;
+	idle_ms = 0;
+	idle_last = idle_ticks - idle_snap;
+	idle_snap = idle_ticks;
+}
+
+void idle_init(void)
+{
+	systick_add_hook(idle_tick);
+}
+
+/******************************************************************************
+       Function description: sleep until the next interrupt
+       Call it in a loop that re-checks its condition. If the interrupt has
+       come already, WFI returns at once; at worst we sleep one tick too long.
+******************************************************************************/
+void idle_wait(void)
+{
+	uint32_t t0 = (uint32_t)get_timer_value();
+	__asm volatile ("wfi");
+	idle_ticks += (uint32_t)get_timer_value() - t0;
+}
+
+/******************************************************************************
+       Function description: idle share of the last full second
+       Return value: 0 (always busy) .. 1000 (always asleep)
+******************************************************************************/
+uint16_t idle_permille(void)
+{
+	uint32_t per_s = SystemCoreClock / 4;		// mtime ticks per second
+	uint32_t t = idle_last;
+	if (t > per_s) t = per_s;
+	return (uint16_t)((uint64_t)t * 1000 / per_s);
+}
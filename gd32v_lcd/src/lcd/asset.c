@@ -0,0 +1,125 @@
+/**************************************************************************
+ * Flash asset store
+ * Code CC-BY untergeekDE
+ *
+ * A full-screen image is 25600 bytes, a fifth of our flash. Packed with
+ * a simple RLE on 16-bit pixels the logo shrinks to about 3.4 KB, and the
+ * decoder is cheap enough to feed the SPI bus directly: it never looks
+ * back at decoded pixels, so it needs no output window in RAM.
+ * *******************************************************************************/
+
+#include "lcd/asset.h"
+#include "lcd/assets_data.h"
+
+
+/******************************************************************************
+Function description: asset table entry
+       Entry data: asset id (ASSET_xxx)
+       Return value: entry, or 0 for an unknown id
+******************************************************************************/
+const Asset *Asset_Get(u8 id)
+{
+	if (id >= ASSET_COUNT) return 0;
+	return &asset_table[id];
+}
+
+
+/******************************************************************************
+Function description: start decoding an asset
+       Entry data: decoder state, asset id
+       Return value: None
+******************************************************************************/
+void Asset_Open(AssetStream *s, u8 id)
+{
+	const Asset *a = Asset_Get(id);
+	s->left = 0;
+	s->run = 0;
+	if (!a)
+	{
+		s->src = s->end = 0;
+		return;
+	}
+	s->src = asset_blob + a->offset;
+	s->end = s->src + a->size;
+	s->codec = a->codec;
+}
+
+
+/******************************************************************************
+Function description: decode the next pixel
+       Entry data: decoder state, where to put the pixel
+       Return value: 1 if there was a pixel, 0 at the end of the asset
+******************************************************************************/
+static inline u8 asset_next(AssetStream *s, uint16_t *px)
+{
+	if (s->codec == ASSET_CODEC_RLE && !s->left)
+	{
+		u8 c;
+		if (s->src >= s->end) return 0;
+		c = *s->src++;
+		s->run = c >> 7;
+		s->left = (c & 0x7F) + 1;
+		if (s->run)
+		{
+			if (s->src + 2 > s->end)	// Truncated run: stop for good
+			{
+				s->src = s->end;
+				s->left = 0;
+				return 0;
+			}
+			s->pixel = (s->src[0] << 8) | s->src[1];
+			s->src += 2;
+		}
+	}
+	if (s->codec != ASSET_CODEC_RLE || !s->run)
+	{
+		if (s->src + 2 > s->end) return 0;
+		s->pixel = (s->src[0] << 8) | s->src[1];
+		s->src += 2;
+	}
+	if (s->left) s->left--;
+	*px = s->pixel;
+	return 1;
+}
+
+
+/******************************************************************************
+Function description: decode up to n pixels into a buffer
+       Entry data: decoder state, pixel buffer, number of pixels
+       Return value: pixels decoded (less than n at the end of the asset)
+******************************************************************************/
+u32 Asset_Read(AssetStream *s, uint16_t *dst, u32 n)
+{
+	u32 i;
+	for (i = 0; i < n && asset_next(s, dst + i); i++);
+	return i;
+}
+
+
+/******************************************************************************
+Function description: draw an asset, decoding straight into the address window
+       A run goes out in one LCD_Bus_Fill of its length.
+       Entry data: x, y upper left corner, asset id
+       Return value: None
+******************************************************************************/
+void LCD_ShowAsset(u16 x, u16 y, u8 id)
+{
+	const Asset *a = Asset_Get(id);
+	AssetStream s;
+	uint16_t px;
+
+	if (!a || x + a->width > LCD_W || y + a->height > LCD_H) return;	// Do nothing if out of bounds
+	Asset_Open(&s, id);
+	LCD_Address_Set(x, y, x + a->width - 1, y + a->height - 1);
+	while (asset_next(&s, &px))
+	{
+		if (s.run && s.left)					// Rest of a run: no decoding
+		{
+			LCD_Bus_Fill(px, s.left + 1);
+			s.left = 0;
+		}
+		else
+			LCD_Bus_Write16(px);
+	}
+	LCD_Bus_End();
+}
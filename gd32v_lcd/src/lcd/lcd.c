@@ -43,31 +43,79 @@
 #include "lcd/lcd.h"
 #include <lcd/oledfont.h>
 #include <lcd/8x8_vertikal_LSB_2.h>		//The CP437 font I ripped
-#include <lcd/bmp.h>
+#include "lcd/lcd_panel.h"			// Init sequences and orientations
+#include "lcd/asset.h"
+#include "lcd/utf8.h"
+#include "idle.h"
+#include "riscv_encoding.h"			// set_csr/clear_csr, MSTATUS_MIE
 u16 BACK_COLOR;   //Background color
 
 
 /******************************************************************************
-       Function description: LCD serial data write function
-       Entry data: one byte to be written via serial 
-       Return value: None
+       Bus transactions
+       CS goes low in LCD_Bus_Begin and stays low until LCD_Bus_End.
+       Nothing ever comes back from the display, so the bytes go out
+       back to back: wait for room in the transmit register, write,
+       next. The receive side is not read; LCD_Bus_End waits once for
+       the last frame to leave the shift register and clears the
+       receive flags. Commands and their parameters use 8-bit frames,
+       pixel data after RAMWR (0x2C) 16-bit frames, so one register
+       write sends a whole pixel. The frame size only changes right
+       after a command, when the bus has to be idle anyway for the DC line.
 ******************************************************************************/
-void LCD_Writ_Bus(u8 dat) 
-{
-#if SPI0_CFG == 1
-	OLED_CS_Clr();
+static volatile u8 lcd_bus_open;	// CS is low; also set and cleared by the queue's DMA interrupt
+
+// Panel profile: init sequence and orientations (lcd/lcd_panel.h)
+#if LCD_PANEL == LCD_PANEL_ST7735R
+#define lcd_panel lcd_panel_st7735r
+#else
+#define lcd_panel lcd_panel_longan
+#endif
+#if LCD_ROTATE
+const LCD_Orientation *lcd_orient = &lcd_panel.orient[USE_HORIZONTAL];
+#else
+#define lcd_orient (&lcd_panel.orient[USE_HORIZONTAL])
+#endif
+
+// Window cache: the controller keeps CASET/RASET until told otherwise,
+// so only the axis that changed is sent again.
+static u16 lcd_win[4];			// x1, x2, y1, y2 in controller RAM
+static u8 lcd_win_valid;
+static LCD_WindowStats lcd_win_stats;
+#if SPI0_CFG == 1 || SPI0_CFG == 2
+static volatile u8 lcd_bus_bits = 8;	// SPI frame size; the queue changes it from the interrupt
 
+// Wait until the last frame is out on the wire
+static void lcd_bus_flush(void)
+{
 	while(RESET == spi_i2s_flag_get(SPI0, SPI_FLAG_TBE));
-        spi_i2s_data_transmit(SPI0, dat);
-	while(RESET == spi_i2s_flag_get(SPI0, SPI_FLAG_RBNE));
-        spi_i2s_data_receive(SPI0);
+	while(RESET != spi_i2s_flag_get(SPI0, SPI_FLAG_TRANS));
+}
 
-	OLED_CS_Set();
-#elif SPI0_CFG == 2
-	spi_dma_enable(SPI0, SPI_DMA_TRANSMIT);
+// Set SPI0 frame size (8 or 16); only allowed while the SPI is disabled
+static void lcd_bus_frame(u8 bits)
+{
+	if (bits == lcd_bus_bits) return;
+	lcd_bus_flush();
+	spi_disable(SPI0);
+	spi_i2s_data_frame_format_config(SPI0, (bits == 16) ? SPI_FRAMESIZE_16BIT : SPI_FRAMESIZE_8BIT);
+	spi_enable(SPI0);
+	lcd_bus_bits = bits;
+}
+
+static inline void lcd_bus_put(u16 dat)
+{
+	while(RESET == spi_i2s_flag_get(SPI0, SPI_FLAG_TBE));
+	spi_i2s_data_transmit(SPI0, dat);
+}
 #else
+static void lcd_bus_flush(void) {}
+static void lcd_bus_frame(u8 bits) { (void)bits; }
+
+// Bit-banged byte
+static void lcd_bus_put(u8 dat)
+{
 	u8 i;
-	OLED_CS_Clr();
 	for(i=0;i<8;i++)
 	{			  
 		OLED_SCLK_Clr();
@@ -78,20 +126,177 @@ void LCD_Writ_Bus(u8 dat)
 		OLED_SCLK_Set();
 		dat<<=1;
 	}	
-  OLED_CS_Set();	
+}
+#endif
+
+// Begin without waiting for the queue, for the queue itself
+static void lcd_bus_begin(void)
+{
+	if (lcd_bus_open) return;
+	OLED_DC_Set();
+	OLED_CS_Clr();
+	lcd_bus_open = 1;
+}
+
+static void lcd_bus_end(void)
+{
+	if (!lcd_bus_open) return;
+	lcd_bus_flush();
+	OLED_CS_Set();
+	lcd_bus_open = 0;
+#if SPI0_CFG == 1 || SPI0_CFG == 2
+	// Nobody read RX: drop the stale frame and the overrun flag
+	(void)SPI_DATA(SPI0);
+	(void)SPI_STAT(SPI0);
 #endif
 }
 
+/******************************************************************************
+       Function description: start a bus transaction (CS low, data mode)
+       Waits for queued drawing first. Does nothing if one is open already.
+******************************************************************************/
+void LCD_Bus_Begin(void)
+{
+	LCD_Sync();
+	lcd_bus_begin();
+}
+
+/******************************************************************************
+       Function description: end the bus transaction (CS high)
+******************************************************************************/
+void LCD_Bus_End(void)
+{
+	lcd_bus_end();
+}
+
+/******************************************************************************
+       Function description: send a command byte inside a transaction
+       DC is sampled with the last bit, so the bus has to run empty
+       before and after the command.
+******************************************************************************/
+// Command without touching the window cache, for lcd_window itself
+static void lcd_bus_cmd(u8 cmd)
+{
+	lcd_bus_flush();
+	OLED_DC_Clr();		//Set to "Write command"
+	lcd_bus_frame(8);
+	lcd_bus_put(cmd);
+	lcd_bus_flush();
+	OLED_DC_Set();		// Back to "Write data"
+}
+
+void LCD_Bus_Cmd(u8 cmd)
+{
+	// Anything but RAMWR may move the window or the panel under us
+	if (cmd != 0x2c) lcd_win_valid = 0;
+	lcd_bus_cmd(cmd);
+}
+
+/******************************************************************************
+       Function description: send data inside a transaction
+       Write8: one byte, Write16: one word (pixel, coordinate), high byte first,
+       WriteN: n bytes from a buffer, Fill: n times the same word
+******************************************************************************/
+void LCD_Bus_Write8(u8 dat)
+{
+	lcd_bus_frame(8);
+	lcd_bus_put(dat);
+}
+
+void LCD_Bus_Write16(u16 dat)
+{
+#if SPI0_CFG == 1 || SPI0_CFG == 2
+	lcd_bus_frame(16);
+	lcd_bus_put(dat);
+#else
+	lcd_bus_put(dat>>8);
+	lcd_bus_put(dat);
+#endif
+}
+
+void LCD_Bus_WriteN(const u8 *buf, u32 n)
+{
+	lcd_bus_frame(8);
+	while (n--) lcd_bus_put(*buf++);
+}
+
+void LCD_Bus_Fill(u16 color, u32 n)
+{
+	while (n--) LCD_Bus_Write16(color);
+}
+
+
+#if LCD_BUS_BENCH && (SPI0_CFG == 1 || SPI0_CFG == 2)
+/******************************************************************************
+       Function description: time a full-screen fill (LCD_W*LCD_H*2 bytes) both ways
+       per_byte: the old way, CS toggled and RX drained around every byte
+       burst: one transaction, 16-bit frames, one wait at the end
+       Both in mtime ticks (SystemCoreClock/4) for the whole screen;
+       divide by LCD_W*LCD_H*2 for ticks per byte.
+******************************************************************************/
+void LCD_Bus_Bench(u32 *per_byte, u32 *burst)
+{
+	uint64_t t;
+	u32 i;
+
+	LCD_Address_Set(0,0,LCD_W-1,LCD_H-1);
+	LCD_Bus_End();
+	lcd_bus_frame(8);
+	OLED_DC_Set();
+	t = get_timer_value();
+	for (i = 0; i < LCD_W*LCD_H*2; i++)
+	{
+		OLED_CS_Clr();
+		while(RESET == spi_i2s_flag_get(SPI0, SPI_FLAG_TBE));
+		spi_i2s_data_transmit(SPI0, (i & 1) ? 0x1F : 0xF8);
+		while(RESET == spi_i2s_flag_get(SPI0, SPI_FLAG_RBNE));
+		spi_i2s_data_receive(SPI0);
+		OLED_CS_Set();
+	}
+	*per_byte = get_timer_value() - t;
+
+	LCD_Address_Set(0,0,LCD_W-1,LCD_H-1);
+	t = get_timer_value();
+	LCD_Bus_Fill(BLUE, LCD_W*LCD_H);
+	LCD_Bus_End();
+	*burst = get_timer_value() - t;
+}
+#endif
+
+
+/******************************************************************************
+       Function description: LCD serial data write function
+       One byte in a transaction of its own.
+       Entry data: one byte to be written via serial 
+       Return value: None
+******************************************************************************/
+void LCD_Writ_Bus(u8 dat) 
+{
+	LCD_Bus_Begin();
+	LCD_Bus_Write8(dat);
+	LCD_Bus_End();
+}
+
 
 /******************************************************************************
        Function description: LCD write data
+       Inside an open transaction (after LCD_Address_Set) the byte just
+       goes out; otherwise it gets a transaction of its own. A transaction
+       the queue holds open is not ours: wait for the queue to finish first.
        Entry data: unsigned byte value to write
        Return value: None
 ******************************************************************************/
 void LCD_WR_DATA8(u8 dat)
 {
-	OLED_DC_Set();		// Set to "Write data"
-	LCD_Writ_Bus(dat);	// Serial write the byte
+	LCD_Sync();			// An open transaction is then the caller's
+	if (lcd_bus_open)
+	{
+		LCD_Bus_Write8(dat);
+		return;
+	}
+	LCD_Bus_Begin();
+	LCD_Bus_Write8(dat);
+	LCD_Bus_End();
 }
 
 
@@ -102,9 +307,15 @@ Function description: LCD write data
 ******************************************************************************/
 void LCD_WR_DATA(u16 dat)
 {
-	OLED_DC_Set();			//Set to "Write data"
-	LCD_Writ_Bus(dat>>8);	//Serial write High byte
-	LCD_Writ_Bus(dat);		//Serial write Low byte
+	LCD_Sync();			// An open transaction is then the caller's
+	if (lcd_bus_open)
+	{
+		LCD_Bus_Write16(dat);
+		return;
+	}
+	LCD_Bus_Begin();
+	LCD_Bus_Write16(dat);
+	LCD_Bus_End();
 }
 
 
@@ -115,61 +326,88 @@ void LCD_WR_DATA(u16 dat)
 ******************************************************************************/
 void LCD_WR_REG(u8 dat)
 {
-	OLED_DC_Clr();		//Set to "Write command"
-	LCD_Writ_Bus(dat);	// Send command byte via serial
+	LCD_Sync();			// An open transaction is then the caller's
+	if (lcd_bus_open)
+	{
+		LCD_Bus_Cmd(dat);
+		return;
+	}
+	LCD_Bus_Begin();	// Don't cut into a queued transfer
+	LCD_Bus_Cmd(dat);
+	LCD_Bus_End();
 }
 
 
 /************************************************* *****************************
        Function description: Set start and end addresses for write
-
+       Opens a bus transaction and leaves it open for the pixel data;
+       close it with LCD_Bus_End().
 
        Entry data: x1, x2 set the start and end column
                  y1, y2 set the start and end line
        Return value: None
 ************************************************** ****************************/
-void LCD_Address_Set(u16 x1,u16 y1,u16 x2,u16 y2)
+// Command parameter word: two bytes in 8-bit frames
+static void lcd_param16(u16 v)
 {
-	if(USE_HORIZONTAL==0)
-	{
-		LCD_WR_REG(0x2a);		//Column address settings
-		LCD_WR_DATA(x1+26);		//x1 - x of 
-		LCD_WR_DATA(x2+26);
-		LCD_WR_REG(0x2b);		//Row address setting
-		LCD_WR_DATA(y1+1);
-		LCD_WR_DATA(y2+1);
-		LCD_WR_REG(0x2c);		//Memory Write
-	}
-	else if(USE_HORIZONTAL==1)
-	{
-		LCD_WR_REG(0x2a);		//Column address settings
-		LCD_WR_DATA(x1+26);
-		LCD_WR_DATA(x2+26);
-		LCD_WR_REG(0x2b);		//Row address setting
-		LCD_WR_DATA(y1+1);
-		LCD_WR_DATA(y2+1);
-		LCD_WR_REG(0x2c);		//Memory write
-	}
-	else if(USE_HORIZONTAL==2)	//IT'S MEEEE!!! THIS IS WHAT WE ARE USING!!!!
+	LCD_Bus_Write8(v>>8);
+	LCD_Bus_Write8(v);
+}
+
+static void lcd_window(u16 x1,u16 y1,u16 x2,u16 y2)
+{
+	// The visible 160x80 sits at an offset in the controller's 162x132 RAM.
+	// Without LCD_ROTATE this is a constant and folds away.
+	x1 += lcd_orient->xoff; x2 += lcd_orient->xoff;
+	y1 += lcd_orient->yoff; y2 += lcd_orient->yoff;
+
+	lcd_win_stats.windows++;
+	if (!lcd_win_valid || x1 != lcd_win[0] || x2 != lcd_win[1])
 	{
-		LCD_WR_REG(0x2a);		//Column address settings
-		LCD_WR_DATA(x1+1);		
-		LCD_WR_DATA(x2+1);
-		LCD_WR_REG(0x2b);		//Row address setting
-		LCD_WR_DATA(y1+26);
-		LCD_WR_DATA(y2+26);
-		LCD_WR_REG(0x2c);		//Memory write
+		lcd_bus_cmd(0x2a);		//Column address settings
+		lcd_param16(x1);
+		lcd_param16(x2);
+		lcd_win[0] = x1; lcd_win[1] = x2;
+		lcd_win_stats.caset++;
 	}
-	else
+	else lcd_win_stats.saved++;
+	if (!lcd_win_valid || y1 != lcd_win[2] || y2 != lcd_win[3])
 	{
-		LCD_WR_REG(0x2a);		//Column address settings
-		LCD_WR_DATA(x1+1);
-		LCD_WR_DATA(x2+1);
-		LCD_WR_REG(0x2b);		//Row address setting
-		LCD_WR_DATA(y1+26);
-		LCD_WR_DATA(y2+26);
-		LCD_WR_REG(0x2c);		//Memory write
+		lcd_bus_cmd(0x2b);		//Row address setting
+		lcd_param16(y1);
+		lcd_param16(y2);
+		lcd_win[2] = y1; lcd_win[3] = y2;
+		lcd_win_stats.raset++;
 	}
+	else lcd_win_stats.saved++;
+	lcd_win_valid = 1;
+	lcd_bus_cmd(0x2c);		//Memory write: always, it rewinds the write pointer
+}
+
+/******************************************************************************
+       Function description: forget the cached window
+       For code that talks to the display behind the library's back.
+       Commands sent through LCD_Bus_Cmd/LCD_WR_REG do this already.
+******************************************************************************/
+void LCD_Window_Invalidate(void)
+{
+	LCD_Sync();
+	lcd_win_valid = 0;
+}
+
+/******************************************************************************
+       Function description: window statistics since boot
+       windows set, CASET and RASET sent, and commands skipped
+******************************************************************************/
+const LCD_WindowStats *LCD_Window_Stats(void)
+{
+	return &lcd_win_stats;
+}
+
+void LCD_Address_Set(u16 x1,u16 y1,u16 x2,u16 y2)
+{
+	LCD_Bus_Begin();
+	lcd_window(x1,y1,x2,y2);
 }
 
 /************************************************* *****************************
@@ -199,10 +437,185 @@ void dma_config(void)
     /* configure DMA mode */
     dma_circulation_disable(DMA0, DMA_CH2);
     dma_memory_to_memory_disable(DMA0, DMA_CH2);
+	dma_interrupt_enable(DMA0, DMA_CH2, DMA_INT_FTF);
+
+	/* the channel only runs while the queue sends pixel data */
+	spi_dma_enable(SPI0, SPI_DMA_TRANSMIT);
+
+	// Interrupts are switched on globally by systick_init(), not here
+	eclic_priority_group_set(ECLIC_PRIGROUP_LEVEL3_PRIO1);
+	eclic_irq_enable(DMA0_Channel2_IRQn, 1, 0);
 }
 #endif
 
-#if SPI0_CFG == 1
+/************************************************* *****************************
+       Command queue
+       Ring of descriptors; the head is filled by the drawing calls,
+       the tail is on the wire. lcdq_start sets the window for the tail
+       descriptor (polled, a dozen bytes) and hands the pixel data to DMA.
+       The DMA-complete interrupt closes the transfer and starts the next one.
+************************************************** ****************************/
+typedef struct {
+	u16 x1, y1, x2, y2;		// Window
+	const u8 *src;			// Data, unless LCDQ_FILL
+	u32 len;				// Bytes (LCDQ_BYTES) or pixels
+	uint16_t color;			// LCDQ_FILL: color
+	u8 kind;
+} LCD_QCmd;
+
+#if SPI0_CFG == 2
+static LCD_QCmd lcdq[LCDQ_SIZE];
+static volatile u8 lcdq_head, lcdq_tail;	// Next free slot, slot on the wire
+static volatile u8 lcdq_busy;				// DMA is running
+static const u8 *lcdq_src;					// Rest of a transfer longer than
+static u32 lcdq_left;						// one DMA run (65535 items)
+static u8 lcdq_step;						// Bytes per item in memory
+
+// Next DMA run of the current descriptor
+static void lcdq_chunk(void)
+{
+	u32 n = (lcdq_left > 0xFFFF) ? 0xFFFF : lcdq_left;
+	dma_channel_disable(DMA0, DMA_CH2);
+	dma_memory_address_config(DMA0, DMA_CH2, (uint32_t)lcdq_src);
+	dma_transfer_number_config(DMA0, DMA_CH2, n);
+	dma_channel_enable(DMA0, DMA_CH2);
+	lcdq_left -= n;
+	lcdq_src += n * lcdq_step;
+}
+
+// Start the descriptor at the tail
+static void lcdq_start(void)
+{
+	LCD_QCmd *c = &lcdq[lcdq_tail];
+
+	lcdq_busy = 1;
+	lcd_bus_begin();		// CS stays low for window and data
+	lcd_window(c->x1, c->y1, c->x2, c->y2);
+	dma_channel_disable(DMA0, DMA_CH2);
+	lcdq_src = c->src;
+	switch (c->kind)
+	{
+	case LCDQ_FILL:
+		// One pixel per 16-bit frame, the color word read over and over
+		lcdq_src = (const u8 *)&c->color;
+		lcdq_step = 0;
+		lcd_bus_frame(16);
+		dma_memory_width_config(DMA0, DMA_CH2, DMA_MEMORY_WIDTH_16BIT);
+		dma_periph_width_config(DMA0, DMA_CH2, DMA_PERIPHERAL_WIDTH_16BIT);
+		break;
+	case LCDQ_PIXELS:
+		// One pixel per frame straight from a uint16_t array
+		lcdq_step = 2;
+		lcd_bus_frame(16);
+		dma_memory_width_config(DMA0, DMA_CH2, DMA_MEMORY_WIDTH_16BIT);
+		dma_periph_width_config(DMA0, DMA_CH2, DMA_PERIPHERAL_WIDTH_16BIT);
+		break;
+	case LCDQ_PIXELS32:
+		// u16 is 32 bits here: DMA reads words and writes their low half
+		lcdq_step = 4;
+		lcd_bus_frame(16);
+		dma_memory_width_config(DMA0, DMA_CH2, DMA_MEMORY_WIDTH_32BIT);
+		dma_periph_width_config(DMA0, DMA_CH2, DMA_PERIPHERAL_WIDTH_16BIT);
+		break;
+	default:
+		// Byte stream, high byte first: must stay in 8-bit frames,
+		// a 16-bit read of little-endian memory would swap the bytes
+		lcdq_step = 1;
+		lcd_bus_frame(8);
+		dma_memory_width_config(DMA0, DMA_CH2, DMA_MEMORY_WIDTH_8BIT);
+		dma_periph_width_config(DMA0, DMA_CH2, DMA_PERIPHERAL_WIDTH_8BIT);
+		break;
+	}
+	if (lcdq_step) dma_memory_increase_enable(DMA0, DMA_CH2);
+	else dma_memory_increase_disable(DMA0, DMA_CH2);
+	lcdq_left = c->len;
+	lcdq_chunk();
+}
+
+/******************************************************************************
+       DMA0 channel 2 (SPI0 TX) complete: next run, next descriptor, or idle
+******************************************************************************/
+void DMA0_Channel2_IRQHandler(void)
+{
+	if (RESET == dma_interrupt_flag_get(DMA0, DMA_CH2, DMA_INT_FLAG_FTF)) return;
+	dma_interrupt_flag_clear(DMA0, DMA_CH2, DMA_INT_FLAG_G);
+
+	if (lcdq_left)
+	{
+		lcdq_chunk();
+		return;
+	}
+
+	dma_channel_disable(DMA0, DMA_CH2);
+	lcd_bus_end();			// Waits for the last frame, CS high
+
+	lcdq_tail = (lcdq_tail + 1) % LCDQ_SIZE;
+	if (lcdq_tail != lcdq_head) lcdq_start();
+	else lcdq_busy = 0;
+}
+#endif
+
+/******************************************************************************
+       Function description: put a descriptor into the queue
+       Waits if the ring is full. Without DMA, draws right away.
+       Entry data: window, kind (LCDQ_...), data, length, color
+       Return value: None
+******************************************************************************/
+static void lcd_submit(u16 x1,u16 y1,u16 x2,u16 y2,u8 kind,const u8 *src,u32 len,u16 color)
+{
+#if SPI0_CFG == 2
+	u8 next = (lcdq_head + 1) % LCDQ_SIZE;
+	LCD_QCmd *c = &lcdq[lcdq_head];
+
+	while (next == lcdq_tail) idle_wait();	// Ring full: sleep until a slot is free
+	c->x1 = x1; c->y1 = y1; c->x2 = x2; c->y2 = y2;
+	c->kind = kind;
+	c->src = src;
+	c->len = len;
+	c->color = color;
+
+	u32 mie = clear_csr(mstatus, MSTATUS_MIE) & MSTATUS_MIE;	// Interrupts off, remember if they were on
+	lcdq_head = next;
+	if (!lcdq_busy) lcdq_start();
+	if (mie) set_csr(mstatus, MSTATUS_MIE);	// Only back on if the caller had them on
+#else
+	LCD_Address_Set(x1,y1,x2,y2);
+	if (kind == LCDQ_FILL)
+		LCD_Bus_Fill(color, len);
+	else if (kind == LCDQ_PIXELS)
+		for (const uint16_t *p = (const uint16_t *)src; len--; ) LCD_Bus_Write16(*p++);
+	else if (kind == LCDQ_PIXELS32)
+		for (const u16 *p = (const u16 *)src; len--; ) LCD_Bus_Write16(*p++);
+	else
+		LCD_Bus_WriteN(src, len);
+	LCD_Bus_End();
+#endif
+}
+
+/******************************************************************************
+       Function description: wait until all queued drawing is done
+******************************************************************************/
+void LCD_Sync(void)
+{
+#if SPI0_CFG == 2
+	while (lcdq_busy) idle_wait();		// The DMA interrupt wakes us
+#endif
+}
+
+/******************************************************************************
+       Function description: number of queued descriptors not yet finished
+       (including the one on the wire)
+******************************************************************************/
+u8 LCD_Pending(void)
+{
+#if SPI0_CFG == 2
+	return (lcdq_head + LCDQ_SIZE - lcdq_tail) % LCDQ_SIZE;
+#else
+	return 0;
+#endif
+}
+
+#if SPI0_CFG == 1 || SPI0_CFG == 2
 /************************************************* *****************************
        Function description: Configure the DMA or SPI peripheral
        Entry data: none
@@ -231,15 +644,33 @@ void spi_config(void)
 #endif
 
 /******************************************************************************
-      LCD initialisation. Gets nothing, returns nothing. 
+       Function description: send one command of a byte-coded sequence
+       Format: see lcd/lcd_panel.h
+       Entry data: position in the sequence (not at LCD_SEQ_END)
+       Return value: delay in ms the command asks for; *seq is moved on
 ******************************************************************************/
-void Lcd_Init(void)
+static u8 lcd_seq_cmd(const uint8_t **seq)
+{
+	const uint8_t *p = *seq;
+	u8 cmd = *p++;
+	u8 n = *p++;
+	LCD_Bus_Begin();				// Command and parameters in one burst
+	LCD_Bus_Cmd(cmd);
+	LCD_Bus_WriteN(p, n & ~LCD_SEQ_DELAY);
+	LCD_Bus_End();
+	p += n & ~LCD_SEQ_DELAY;
+	*seq = p + ((n & LCD_SEQ_DELAY) ? 1 : 0);
+	return (n & LCD_SEQ_DELAY) ? *p : 0;
+}
+
+// Clocks, pins, SPI (and DMA) for the display
+static void lcd_hw_init(void)
 {
 	rcu_periph_clock_enable(RCU_GPIOA);
 	rcu_periph_clock_enable(RCU_GPIOB);
 
 
-#if SPI0_CFG == 1
+#if SPI0_CFG == 1 || SPI0_CFG == 2
  	rcu_periph_clock_enable(RCU_AF);
 	rcu_periph_clock_enable(RCU_SPI0);
 	/* SPI0 GPIO config: NSS/PA4, SCK/PA5, MOSI/PA7 */
@@ -247,19 +678,11 @@ void Lcd_Init(void)
 	gpio_init(GPIOB, GPIO_MODE_OUT_PP, GPIO_OSPEED_50MHZ, GPIO_PIN_2);
 
 	spi_config();
-
-#elif SPI0_CFG == 2
+#if SPI0_CFG == 2
     rcu_periph_clock_enable(RCU_DMA0);
-    rcu_periph_clock_enable(RCU_SPI0);
-
-	/* SPI0 GPIO config: NSS/PA4, SCK/PA5, MOSI/PA7 */
-    gpio_init(GPIOA, GPIO_MODE_AF_PP, GPIO_OSPEED_50MHZ, GPIO_PIN_4 | GPIO_PIN_5 | GPIO_PIN_7);
-    /* SPI0 GPIO config: MISO/PA6 */
-    gpio_init(GPIOA, GPIO_MODE_IN_FLOATING, GPIO_OSPEED_50MHZ, GPIO_PIN_6);
-
 	dma_config();
+#endif
 
-	dma_channel_enable(DMA0,DMA_CH2);
 #elif SPI0_CFG == 3
 	gpio_init(GPIOA, GPIO_MODE_OUT_PP, GPIO_OSPEED_50MHZ, GPIO_PIN_5 | GPIO_PIN_7);
 	gpio_init(GPIOB, GPIO_MODE_OUT_PP, GPIO_OSPEED_50MHZ, GPIO_PIN_2);
@@ -271,111 +694,100 @@ void Lcd_Init(void)
 	gpio_init(GPIOB, GPIO_MODE_OUT_PP, GPIO_OSPEED_50MHZ, GPIO_PIN_0 | GPIO_PIN_1);
 	gpio_bit_reset(GPIOB, GPIO_PIN_0 | GPIO_PIN_1);
 
-	OLED_RST_Clr();
-	delay_1ms(200);
-	OLED_RST_Set();
-	delay_1ms(20);
-	OLED_BLK_Set();
-
-	LCD_WR_REG(0x11);	// turn off sleep mode
-	delay_1ms(100);
-
-	LCD_WR_REG(0x21);	// display inversion mode
-
-	LCD_WR_REG(0xB1);	// Set the frame frequency of the full colors normal mode
-						// Frame rate=fosc/((RTNA x 2 + 40) x (LINE + FPA + BPA +2))
-						// fosc = 850kHz
-	LCD_WR_DATA8(0x05);	// RTNA
-	LCD_WR_DATA8(0x3A);	// FPA
-	LCD_WR_DATA8(0x3A);	// BPA
-
-	LCD_WR_REG(0xB2);	// Set the frame frequency of the Idle mode
-						// Frame rate=fosc/((RTNB x 2 + 40) x (LINE + FPB + BPB +2))
-						// fosc = 850kHz
-	LCD_WR_DATA8(0x05);	// RTNB
-	LCD_WR_DATA8(0x3A);	// FPB
-	LCD_WR_DATA8(0x3A);	// BPB
-
-	LCD_WR_REG(0xB3);	// Set the frame frequency of the Partial mode/ full colors
-	LCD_WR_DATA8(0x05);  
-	LCD_WR_DATA8(0x3A);
-	LCD_WR_DATA8(0x3A);
-	LCD_WR_DATA8(0x05);
-	LCD_WR_DATA8(0x3A);
-	LCD_WR_DATA8(0x3A);
-
-	LCD_WR_REG(0xB4);
-	LCD_WR_DATA8(0x03);
-
-	LCD_WR_REG(0xC0);
-	LCD_WR_DATA8(0x62);
-	LCD_WR_DATA8(0x02);
-	LCD_WR_DATA8(0x04);
-
-	LCD_WR_REG(0xC1);
-	LCD_WR_DATA8(0xC0);
-
-	LCD_WR_REG(0xC2);
-	LCD_WR_DATA8(0x0D);
-	LCD_WR_DATA8(0x00);
-
-	LCD_WR_REG(0xC3);
-	LCD_WR_DATA8(0x8D);
-	LCD_WR_DATA8(0x6A);   
-
-	LCD_WR_REG(0xC4);
-	LCD_WR_DATA8(0x8D); 
-	LCD_WR_DATA8(0xEE); 
-
-	LCD_WR_REG(0xC5);  /*VCOM*/
-	LCD_WR_DATA8(0x0E);    
-
-	LCD_WR_REG(0xE0);
-	LCD_WR_DATA8(0x10);
-	LCD_WR_DATA8(0x0E);
-	LCD_WR_DATA8(0x02);
-	LCD_WR_DATA8(0x03);
-	LCD_WR_DATA8(0x0E);
-	LCD_WR_DATA8(0x07);
-	LCD_WR_DATA8(0x02);
-	LCD_WR_DATA8(0x07);
-	LCD_WR_DATA8(0x0A);
-	LCD_WR_DATA8(0x12);
-	LCD_WR_DATA8(0x27);
-	LCD_WR_DATA8(0x37);
-	LCD_WR_DATA8(0x00);
-	LCD_WR_DATA8(0x0D);
-	LCD_WR_DATA8(0x0E);
-	LCD_WR_DATA8(0x10);
-
-	LCD_WR_REG(0xE1);
-	LCD_WR_DATA8(0x10);
-	LCD_WR_DATA8(0x0E);
-	LCD_WR_DATA8(0x03);
-	LCD_WR_DATA8(0x03);
-	LCD_WR_DATA8(0x0F);
-	LCD_WR_DATA8(0x06);
-	LCD_WR_DATA8(0x02);
-	LCD_WR_DATA8(0x08);
-	LCD_WR_DATA8(0x0A);
-	LCD_WR_DATA8(0x13);
-	LCD_WR_DATA8(0x26);
-	LCD_WR_DATA8(0x36);
-	LCD_WR_DATA8(0x00);
-	LCD_WR_DATA8(0x0D);
-	LCD_WR_DATA8(0x0E);
-	LCD_WR_DATA8(0x10);
-
-	LCD_WR_REG(0x3A);	// define the format of RGB picture data
-	LCD_WR_DATA8(0x05);	// 16-bit/pixel
-
-	LCD_WR_REG(0x36);
-	if(USE_HORIZONTAL==0)LCD_WR_DATA8(0x08);
-	else if(USE_HORIZONTAL==1)LCD_WR_DATA8(0xC8);
-	else if(USE_HORIZONTAL==2)LCD_WR_DATA8(0x78);
-	else LCD_WR_DATA8(0xA8);
-
-	LCD_WR_REG(0x29);	// Display On
+}
+
+/******************************************************************************
+      LCD initialisation. Gets nothing, returns nothing. 
+      Lcd_Init() just runs Lcd_Init_Step() until it is done. That one is a
+      state machine: every call does one small piece (bus setup, reset
+      edge, one command of the init sequence) and returns. During the reset and sleep-out waits it returns at once,
+      so other init work (the SD card) can run in between.
+******************************************************************************/
+enum { LCDI_START, LCDI_RESET, LCDI_WAKE, LCDI_SEQ, LCDI_ON, LCDI_DONE };
+static u8 lcdi_state = LCDI_START;
+static const uint8_t *lcdi_seq;			// Next command of the init sequence
+static uint64_t lcdi_until;				// mtime: nothing to do before this
+
+static void lcdi_wait(u32 ms)
+{
+	lcdi_until = get_timer_value() + (uint64_t)SystemCoreClock / 4000 * ms;
+}
+
+void Lcd_Init(void)
+{
+	lcdi_state = LCDI_START;
+	while (Lcd_Init_Step());
+}
+
+/******************************************************************************
+       Function description: advance the LCD init by one step
+       Return value: 1 while there is more to do, 0 when the display is ready
+******************************************************************************/
+int Lcd_Init_Step(void)
+{
+	if (get_timer_value() < lcdi_until) return 1;	// Still waiting
+	switch (lcdi_state)
+	{
+	case LCDI_START:
+		lcd_hw_init();
+		OLED_RST_Clr();
+		lcdi_wait(1);				// Reset pulse: 10us minimum
+		lcdi_state = LCDI_RESET;
+		return 1;
+	case LCDI_RESET:
+		OLED_RST_Set();
+		lcdi_wait(120);				// No Sleep Out within 120ms of a reset
+		lcdi_state = LCDI_WAKE;
+		return 1;
+	case LCDI_WAKE:
+		OLED_BLK_Set();
+		lcdi_seq = lcd_panel.init;
+		lcdi_state = LCDI_SEQ;
+		/* fall through */
+	case LCDI_SEQ:
+		if (*lcdi_seq != 0x29 && *lcdi_seq != LCD_SEQ_END)
+		{
+			lcdi_wait(lcd_seq_cmd(&lcdi_seq));
+			return 1;
+		}
+		// Orientation before Display On, so the first frame isn't mirrored
+		LCD_Bus_Begin();
+		LCD_Bus_Cmd(0x36);			// Memory access control: orientation
+		LCD_Bus_Write8(lcd_orient->madctl);
+		LCD_Bus_End();
+		lcdi_state = LCDI_ON;
+		return 1;
+	case LCDI_ON:					// Display On and whatever follows it
+		if (*lcdi_seq != LCD_SEQ_END)
+		{
+			lcdi_wait(lcd_seq_cmd(&lcdi_seq));
+			return 1;
+		}
+		lcdi_state = LCDI_DONE;
+		return 0;
+	default:
+		return 0;
+	}
+}
+
+/******************************************************************************
+       Function description: switch orientation at runtime
+       The picture on the panel stays as it is; redraw afterwards.
+       Entry data: o 0..3, same meaning as USE_HORIZONTAL
+       Return value: None
+******************************************************************************/
+void LCD_SetOrientation(u8 o)
+{
+#if LCD_ROTATE
+	if (o > 3) return;
+	LCD_Bus_Begin();			// Waits for the queue
+	lcd_orient = &lcd_panel.orient[o];
+	LCD_Bus_Cmd(0x36);			// Also drops the window cache
+	LCD_Bus_Write8(lcd_orient->madctl);
+	LCD_Bus_End();
+#else
+	(void)o;					// Fixed at compile time by USE_HORIZONTAL
+#endif
 }
 
 /******************************************************************************
@@ -383,15 +795,7 @@ void Lcd_Init(void)
 ******************************************************************************/
 void LCD_Clear(u16 Color)
 {
-	u16 i,j;  	
-	LCD_Address_Set(0,0,LCD_W-1,LCD_H-1);
-    for(i=0;i<LCD_W;i++)
-	  {
-			for (j=0;j<LCD_H;j++)
-				{
-					LCD_WR_DATA(Color);
-				}
-	  }
+	LCD_Fill(0,0,LCD_W-1,LCD_H-1,Color);
 }
 
 
@@ -403,7 +807,8 @@ Function: Draw a colored pixel
 void LCD_DrawPoint(u16 x,u16 y,u16 color)
 {
 	LCD_Address_Set(x,y,x,y);	//Frame to write to 
-	LCD_WR_DATA(color);
+	LCD_Bus_Write16(color);
+	LCD_Bus_End();
 } 
 
 
@@ -426,12 +831,7 @@ Function description: fill rectangle with specified color
 ******************************************************************************/
 void LCD_Fill(u16 xsta,u16 ysta,u16 xend,u16 yend,u16 color)
 {          
-	u16 i,j; 
-	LCD_Address_Set(xsta,ysta,xend,yend);      // Frame to fill 
-	for(i=ysta;i<=yend;i++)
-	{													   	 	
-		for(j=xsta;j<=xend;j++)LCD_WR_DATA(color);//Send Data 	    
-	} 					  	    
+	lcd_submit(xsta,ysta,xend,yend,LCDQ_FILL,0,(u32)(xend-xsta+1)*(yend-ysta+1),color);
 }
 
 
@@ -532,11 +932,21 @@ void LCD_ShowString(u16 x,u16 y,const u8 *p,u16 color)
 	LCD_ShowStringX(x,y,p,color,SMALL);
 }
 
+/******************************************************************************
+Function description: display UTF-8 string in one of the printChar font sizes
+       Characters the font does not have are shown as '?'.
+       Entry data: x, y starting point coordinates
+                 * p string start address, fontsize 0..5 (see LCD_printChar)
+       Return value: None
+******************************************************************************/
 void LCD_ShowStringX(u16 x,u16 y,const u8 *p,u16 color, u8 fontsize)
 {         
-	while(*p!='\0')
+	u32 cp;
+	while((cp = UTF8_Next(&p)) != 0)
     {       
-        LCD_printChar(x,y,*p,color,fontsize);
+		// Even sizes use the CP437 8x8 font, odd sizes the 8x16 font
+		u8 c = (fontsize & 1) ? ASC16_Glyph(cp) : CP437_Glyph(cp);
+        LCD_printChar(x,y,c,color,fontsize);
         x+=8;
 		if (fontsize>1) x+=8;
 		if (fontsize>3) x+=8;
@@ -545,7 +955,6 @@ void LCD_ShowStringX(u16 x,u16 y,const u8 *p,u16 color, u8 fontsize)
 			x -= LCD_W;
 			y += 8+(fontsize*8);
 		}
-        p++;
     }  
 }
 
@@ -636,23 +1045,36 @@ Function description: display 40x40 picture
 ******************************************************************************/
 void LCD_ShowPicture(u16 x1,u16 y1,u16 x2,u16 y2)
 {
-	int i;
-	LCD_Address_Set(x1,y1,x2,y2);
-	for(i=0;i<12800;i++)
-	{ 	
-		// LCD_WR_DATA8(image[i*2+1]);
-		LCD_WR_DATA8(image[i]);
-	}			
+	lcd_submit(x1,y1,x2,y2,LCDQ_BYTES,image,sizeof(image),0);
+}
+
+/******************************************************************************
+Function description: queue a picture from any buffer
+       Entry data: window; buf holds 2 bytes per pixel, high byte first.
+       The buffer is read by DMA later: don't touch it before LCD_Pending()
+       says the queue is past it (or LCD_Sync()).
+       Return value: None
+******************************************************************************/
+void LCD_QueuePicture(u16 x1,u16 y1,u16 x2,u16 y2,const u8 *buf)
+{
+	lcd_submit(x1,y1,x2,y2,LCDQ_BYTES,buf,(u32)(x2-x1+1)*(y2-y1+1)*2,0);
+}
+
+/******************************************************************************
+Function description: queue pixels from a native RGB565 array
+       Sent as 16-bit frames, with DMA as 16-bit transfers, no byte swapping.
+       Same rule as LCD_QueuePicture: leave the buffer alone until it is sent.
+       Entry data: window, one uint16_t per pixel, row by row
+       Return value: None
+******************************************************************************/
+void LCD_QueuePixels(u16 x1,u16 y1,u16 x2,u16 y2,const uint16_t *buf)
+{
+	lcd_submit(x1,y1,x2,y2,LCDQ_PIXELS,(const u8 *)buf,(u32)(x2-x1+1)*(y2-y1+1),0);
 }
 
 void LCD_ShowLogo(void)
 {
-	int i;
-	LCD_Address_Set(0,0,159,75);
-	for(i=0;i<25600;i++)
-	{
-		LCD_WR_DATA8(logo_bmp[i]);
-	}			
+	LCD_ShowAsset(0,0,ASSET_LOGO);		// 160x80, RLE-packed in flash
 }
 
 
@@ -668,16 +1090,14 @@ void LCD_drawBitmap(u16 *b, u8 x1, u8 y1, u8 Width, u8 Height)
 {
 	u8 x2 = x1+Width-1;
 	u8 y2 = y1+Height-1;
-	u16 i;
 	if (x2 >= LCD_W) return; // Do nothing if out of bounds.
 	if (y2 >= LCD_H) return; // Do nothing if out of bounds.	 
 	// TODO: Write a clipping routine. 
 
-	LCD_Address_Set(x1,y1,x2,y2); 
-	for(i=0;i<Width*Height;i++)
-	{						 
-		LCD_WR_DATA(*b++); 	    
-	} 	
+	// Pixel data through the queue (DMA), but the caller owns the buffer:
+	// wait until it is sent.
+	lcd_submit(x1,y1,x2,y2,LCDQ_PIXELS32,(const u8 *)b,(u32)Width*Height,0);
+	LCD_Sync();
 }
 
 
@@ -694,23 +1114,25 @@ void LCD_ShowChar(u16 x,u16 y,u8 num,u8 mode,u16 color)
     u8 pos,t;
 	  u16 x0=x;    
     if(x>LCD_W-16||y>LCD_H-16)return;	    // Setting window: Out-of-bounds chars ignored	   
+	if(num<' '||num>0x80) num='?';			// Not in the font
 	num=num-' ';							// ASCII offset: Don't print anything below 32 
-	LCD_Address_Set(x,y,x+8-1,y+16-1);      // Set cursor position
 	if(!mode) 								// Overwrite
 	{
+		LCD_Address_Set(x,y,x+8-1,y+16-1);      // Set cursor position
 		for(pos=0;pos<16;pos++)
 		{ 
 			temp=asc2_1608[(u16)num*16+pos];		 //Copy from 1608 font
 			for(t=0;t<8;t++)
 		    {                 
-		        if(temp&0x01)LCD_WR_DATA(color);
-				else LCD_WR_DATA(BACK_COLOR);
+		        if(temp&0x01)LCD_Bus_Write16(color);
+				else LCD_Bus_Write16(BACK_COLOR);
 				temp>>=1;
 				x++;
 		    }
 			x=x0;
 			y++;
 		}	
+		LCD_Bus_End();
 	}else											// Transparent
 	{
 		for(pos=0;pos<16;pos++)
@@ -737,10 +1159,42 @@ void LCD_ShowChar(u16 x,u16 y,u8 num,u8 mode,u16 color)
  * 
  * Colors are 16-bit values of the form 
  * RRRRRGGGGGGBBBBBb
+ * (Shifting the whole word lets the low bit of each channel
+ * bleed into the next one - blend with black instead.)
  ********************************************************/
 u16 dampenColor(u16 color)
 {
-	return ((color & 0xF800) >> 1) | ((color & 0x07E0) >> 1) | ((color & 0x001F) >> 1);
+	return LCD_Lerp565(BLACK, color, 16);
+}
+
+/********************************************************
+ * Function: LCD_BlendLUT(fg, bg)
+ * Returns a table of 16 colors fading from bg (index 0)
+ * to fg (index 15), for anti-aliased glyphs with 4-bit
+ * coverage. The last BLEND_CACHE tables are kept, so
+ * a string in one color pair builds its table once.
+ ********************************************************/
+static struct {
+	uint16_t fg, bg;
+	uint16_t lut[16];
+} blend_cache[BLEND_CACHE];
+static u8 blend_used, blend_next;
+
+const uint16_t *LCD_BlendLUT(u16 fg, u16 bg)
+{
+	u8 i;
+	for (i = 0; i < blend_used; i++)
+		if (blend_cache[i].fg == fg && blend_cache[i].bg == bg) return blend_cache[i].lut;
+
+	// Miss: build a new table in the oldest slot
+	i = blend_next;
+	blend_next = (blend_next + 1) % BLEND_CACHE;
+	if (blend_used < BLEND_CACHE) blend_used++;
+	blend_cache[i].fg = fg;
+	blend_cache[i].bg = bg;
+	for (u8 a = 0; a < 16; a++)
+		blend_cache[i].lut[a] = LCD_Lerp565(bg, fg, (a * 32 + 7) / 15);	// 0..15 -> 0..32
+	return blend_cache[i].lut;
 }
 
 /********************************************************
@@ -856,6 +1310,9 @@ void LCD_printChar(u16 x,u16 y,u8 c,u16 color,u8 fontsize)
 	// Maximal bitmap size
 	// DELAY TO DEBUG
 
+	// The 8x16 font only has 0x20..0x80; don't read past it
+	if ((fontsize & 1) && (c < ' ' || c > 0x80)) c = '?';
+
 // ###################################
 //  fontsize=0 ==> Standard 8x8 chars
 //  (Only do if not out of bounds)
@@ -871,9 +1328,10 @@ if (fontsize == 0 && (x<LCD_W-7 && y<LCD_H-7))
 			{
 				// LSB is on top; mask. 
 				buf[xx][yy] = (((1 << yy) & BasicFont[c][xx]) != 0) ? color : BACK_COLOR;
-				LCD_WR_DATA(buf[xx][yy]);
+				LCD_Bus_Write16(buf[xx][yy]);
 			}
 		}
+		LCD_Bus_End();
 	}
 
 // ###################################
@@ -897,7 +1355,8 @@ if (fontsize == 2 && (x<LCD_W-15 && y<LCD_H-15))
 		LCD_Address_Set(x,y,x+15,y+15);
 		for (u8 yy=0;yy<16;yy++)
 			for(u8 xx=0;xx<16;xx++)
-				LCD_WR_DATA(buf[xx][yy]);
+				LCD_Bus_Write16(buf[xx][yy]);
+		LCD_Bus_End();
 	}
 
 // ###################################
@@ -921,7 +1380,8 @@ if (fontsize == 4 && (x<LCD_W-23 && y<LCD_H-23))
 		LCD_Address_Set(x,y,x+23,y+23);
 		for (u8 yy=0;yy<24;yy++)
 			for(u8 xx=0;xx<24;xx++)
-				LCD_WR_DATA(buf[xx][yy]);
+				LCD_Bus_Write16(buf[xx][yy]);
+		LCD_Bus_End();
 	}
 
 
@@ -946,7 +1406,8 @@ if (fontsize == 4 && (x<LCD_W-23 && y<LCD_H-23))
 		LCD_Address_Set(x,y,x+7,y+15);
 		for (u8 yy=0;yy<16;yy++)
 			for(u8 xx=0;xx<8;xx++)
-				LCD_WR_DATA(buf[xx][yy]);
+				LCD_Bus_Write16(buf[xx][yy]);
+		LCD_Bus_End();
 	} // end fontsize==1
 
 // ###################################
@@ -971,7 +1432,8 @@ if (fontsize == 4 && (x<LCD_W-23 && y<LCD_H-23))
 		LCD_Address_Set(x,y,x+15,y+31);
 		for (u8 yy=0;yy<32;yy++)
 			for(u8 xx=0;xx<16;xx++)
-				LCD_WR_DATA(buf[xx][yy]);
+				LCD_Bus_Write16(buf[xx][yy]);
+		LCD_Bus_End();
 	} // end fontsize==3
 // ###################################
 //  fontsize==5 ==> use default font and scale3x it
@@ -995,6 +1457,7 @@ if (fontsize == 4 && (x<LCD_W-23 && y<LCD_H-23))
 		LCD_Address_Set(x,y,x+23,y+47);
 		for (u8 yy=0;yy<48;yy++)
 			for(u8 xx=0;xx<24;xx++)
-				LCD_WR_DATA(buf[xx][yy]);
+				LCD_Bus_Write16(buf[xx][yy]);
+		LCD_Bus_End();
 	} // end fontsize==5
 }
@@ -0,0 +1,181 @@
+/**************************************************************************
+ * Proportional font renderer
+ * Code CC-BY untergeekDE
+ *
+ * The fixed-width fonts waste a lot of our 160 pixels: an "i" takes as
+ * much room as a "W". The PFont format (see lcd/pfont.h) stores each glyph
+ * with its own width and advance, plus a small table of kerning pairs.
+ *
+ * A string is drawn in one go: the glyph columns are OR-ed into a
+ * column buffer first, then the whole string goes out through a single
+ * address window, row by row. No window setup per character.
+ *
+ * Anti-aliased fonts (2 or 4 bpp) go through the same column buffer, as
+ * 4-bit coverage values, and are colored by a 16-entry blend table:
+ * one lookup per pixel.
+ * *******************************************************************************/
+
+#include <string.h>
+#include "lcd/pfont.h"
+#include "lcd/utf8.h"
+#include "lcd/pfont_prop8.h"
+#include "lcd/pfont_prop16.h"
+#include "lcd/pfont_prop8aa.h"
+
+// String bitmap, one column per pixel of the display width (in any orientation).
+// 1bpp fonts keep their own column bytes, anti-aliased fonts one nibble per pixel.
+static uint8_t pf_cols[LCD_MAX_DIM*PFONT_COL_BYTES];
+
+
+/******************************************************************************
+Function description: look up a glyph
+       Entry data: font, code point
+       Return value: glyph, or 0 if the character is not in the font
+******************************************************************************/
+static const PFontGlyph *pfont_glyph(const PFont *f, u32 c)
+{
+	if (c < f->first || c > f->last) return 0;
+	return &f->glyph[c - f->first];
+}
+
+
+/******************************************************************************
+Function description: kerning adjustment for a character pair
+       Binary search, the pair table is sorted by left, then right.
+       Return value: pixels to add to the advance (usually negative)
+******************************************************************************/
+static int pfont_kern(const PFont *f, u8 l, u8 r)
+{
+	int lo = 0, hi = (int)f->nkern - 1;
+	u16 key = (l << 8) | r;
+	while (lo <= hi)
+	{
+		int mid = (lo + hi) >> 1;
+		u16 k = (f->kern[mid].left << 8) | f->kern[mid].right;
+		if (k == key) return f->kern[mid].adjust;
+		if (k < key) lo = mid + 1;
+		else hi = mid - 1;
+	}
+	return 0;
+}
+
+
+/******************************************************************************
+Function description: merge one anti-aliased glyph column into the buffer
+       Coverage is widened to 4 bits; where kerned glyphs overlap,
+       the larger coverage wins.
+       Entry data: font, glyph column, buffer column (one nibble per row)
+       Return value: None
+******************************************************************************/
+static void pfont_merge_aa(const PFont *f, const u8 *src, u8 *dst)
+{
+	const u8 mask = (1 << f->bpp) - 1;
+	u16 bit = 0;
+	for (u8 row = 0; row < f->height; row++, bit += f->bpp)
+	{
+		u8 v = (src[bit >> 3] >> (bit & 7)) & mask;
+		u8 sh = (row & 1) << 2;
+		if (f->bpp == 2) v *= 5;				// 0..3 -> 0..15
+		if (v > ((dst[row >> 1] >> sh) & 0x0F))
+			dst[row >> 1] = (dst[row >> 1] & ~(0x0F << sh)) | (v << sh);
+	}
+}
+
+
+/******************************************************************************
+Function description: width of a string in pixels
+       The larger of the summed advances and the right edge of the last ink,
+       i.e. exactly the window LCD_ShowStringP will paint.
+       Entry data: font, UTF-8 string
+       Return value: width in pixels
+******************************************************************************/
+u16 PFont_TextWidth(const PFont *f, const u8 *p)
+{
+	int pen = 0, right = 0;
+	u8 prev = 0;
+	u32 c;
+	while ((c = UTF8_Next(&p)) != 0)
+	{
+		const PFontGlyph *g = pfont_glyph(f, c);
+		if (!g) continue;					// Not in the font: skip
+		if (prev) pen += pfont_kern(f, prev, c);
+		prev = c;
+		if (pen + g->xoff + g->width > right) right = pen + g->xoff + g->width;
+		pen += g->advance;
+	}
+	return (pen > right) ? pen : right;
+}
+
+
+/******************************************************************************
+Function description: display string in a proportional font (no wrapping)
+       Clipped at the right edge of the display.
+       Entry data: x, y upper left corner
+                 p UTF-8 string, color foreground color (background is BACK_COLOR)
+                 f font
+       Return value: x position after the string
+******************************************************************************/
+u16 LCD_ShowStringP(u16 x,u16 y,const u8 *p,u16 color,const PFont *f)
+{
+	const u8 cb = (f->height * f->bpp + 7) >> 3;	// Font bytes per column
+	const u8 cs = (f->bpp == 1) ? cb : (f->height + 1) >> 1;	// Buffer bytes per column
+	u16 w, row, col;
+	int pen = 0;
+	u8 prev = 0;
+	u32 c;
+
+	if (x >= LCD_W || y + f->height > LCD_H) return x;
+	w = PFont_TextWidth(f, p);
+	if (w > LCD_W - x) w = LCD_W - x;		// Clip
+	if (!w) return x;
+
+	// Collect the glyph columns. Kerned glyphs may overlap, hence OR (or max).
+	memset(pf_cols, 0, w * cs);
+	while ((c = UTF8_Next(&p)) != 0)
+	{
+		const PFontGlyph *g = pfont_glyph(f, c);
+		const u8 *src;
+		int cx;
+		if (!g) continue;
+		if (prev) pen += pfont_kern(f, prev, c);
+		prev = c;
+		src = f->bitmap + g->offset;
+		cx = pen + g->xoff;
+		for (col = 0; col < g->width; col++, cx++, src += cb)
+		{
+			if (cx < 0 || cx >= w) continue;
+			if (f->bpp == 1)
+				for (u8 b = 0; b < cb; b++) pf_cols[cx * cs + b] |= src[b];
+			else
+				pfont_merge_aa(f, src, pf_cols + cx * cs);
+		}
+		pen += g->advance;
+		if (pen >= w) break;				// Rest is clipped anyway
+	}
+
+	// One window for the whole string, written row by row
+	LCD_Address_Set(x, y, x + w - 1, y + f->height - 1);
+	if (f->bpp == 1)
+	{
+		for (row = 0; row < f->height; row++)
+		{
+			const u8 *c = pf_cols + (row >> 3);
+			u8 mask = 1 << (row & 7);			// LSB is on top
+			for (col = 0; col < w; col++, c += cs)
+				LCD_Bus_Write16((*c & mask) ? color : BACK_COLOR);
+		}
+	}
+	else
+	{
+		const uint16_t *lut = LCD_BlendLUT(color, BACK_COLOR);
+		for (row = 0; row < f->height; row++)
+		{
+			const u8 *c = pf_cols + (row >> 1);
+			u8 sh = (row & 1) << 2;
+			for (col = 0; col < w; col++, c += cs)
+				LCD_Bus_Write16(lut[(*c >> sh) & 0x0F]);
+		}
+	}
+	LCD_Bus_End();
+	return x + w;
+}
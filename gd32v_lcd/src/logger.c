@@ -0,0 +1,99 @@
+/**************************************************************************
+ * Buffered append-only logger
+ * Code CC-BY untergeekDE
+ *
+ * A FatFs write of less than a sector goes through the file's sector
+ * buffer: read-modify-write, and the FAT and directory entry get updated
+ * on every f_sync. Here the records are collected until a sector is full
+ * and then written in one piece. The file position is kept on a sector
+ * boundary: when appending to a file that ends mid-sector, the first
+ * buffer is only filled up to that boundary.
+ * *******************************************************************************/
+
+#include <string.h>
+#include "logger.h"
+
+/******************************************************************************
+       Function description: open a log file for appending
+       Entry data: logger, file name
+       Return value: FatFs result
+******************************************************************************/
+FRESULT log_open(Logger *lg, const char *path)
+{
+	FRESULT fr = f_open(&lg->fil, path, FA_WRITE | FA_OPEN_APPEND);
+	if (fr) return fr;
+	lg->fill = 0;
+	lg->room = 512 - (UINT)(f_size(&lg->fil) % 512);
+	lg->sync_due = systick_ms + LOG_SYNC_MS;
+	lg->bytes = lg->sectors = lg->syncs = 0;
+	return FR_OK;
+}
+
+// Hand the buffer to FatFs
+static FRESULT log_put(Logger *lg)
+{
+	UINT bw;
+	FRESULT fr;
+
+	if (!lg->fill) return FR_OK;
+	fr = f_write(&lg->fil, lg->buf, lg->fill, &bw);
+	if (fr) return fr;
+	if (bw < lg->fill) return FR_DENIED;		// Card full
+	lg->sectors++;
+	if (lg->fill == lg->room) lg->room = 512;	// On a sector boundary now
+	else lg->room -= lg->fill;
+	lg->fill = 0;
+	return FR_OK;
+}
+
+/******************************************************************************
+       Function description: append a record
+       Records may span sectors. Writes only when a sector is full, and
+       syncs when LOG_SYNC_MS have passed.
+       Entry data: logger, record, length in bytes
+       Return value: FatFs result
+******************************************************************************/
+FRESULT log_write(Logger *lg, const void *rec, UINT len)
+{
+	const BYTE *p = rec;
+	FRESULT fr;
+
+	lg->bytes += len;
+	while (len)
+	{
+		UINT n = lg->room - lg->fill;
+		if (n > len) n = len;
+		memcpy(lg->buf + lg->fill, p, n);
+		lg->fill += n;
+		p += n;
+		len -= n;
+		if (lg->fill == lg->room)
+		{
+			fr = log_put(lg);
+			if (fr) return fr;
+		}
+	}
+	if ((int32_t)(systick_ms - lg->sync_due) >= 0)
+	{
+		lg->sync_due = systick_ms + LOG_SYNC_MS;
+		lg->syncs++;
+		return f_sync(&lg->fil);				// Whole sectors only: the buffer stays
+	}
+	return FR_OK;
+}
+
+FRESULT log_flush(Logger *lg)
+{
+	FRESULT fr = log_put(lg);
+	if (fr) return fr;
+	lg->sync_due = systick_ms + LOG_SYNC_MS;
+	lg->syncs++;
+	return f_sync(&lg->fil);
+}
+
+FRESULT log_close(Logger *lg)
+{
+	FRESULT fr = log_put(lg);
+	FRESULT fc = f_close(&lg->fil);
+	return fr ? fr : fc;
+}
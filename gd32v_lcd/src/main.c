@@ -1,5 +1,13 @@
 #include "lcd/lcd.h"
+#include "lcd/pfont.h"
 #include "fatfs/tf_card.h"
+#include "fatfs/blkcache.h"
+#include "bootprof.h"
+#include "sched.h"
+#include "idle.h"
+#include "player.h"
+#include "logger.h"
+#include "manifest.h"
 #include <string.h>
 
 unsigned char image[12800];
@@ -32,127 +40,246 @@ void init_uart0(void)
     usart_interrupt_enable(USART0, USART_INT_RBNE);
 }
 
+/******************************************************************************
+ * Tasks. Each one does a little and returns; the scheduler calls them again.
+ * Where the old loops had delay_1ms, the tasks start a soft_timer and
+ * return until it has run out.
+******************************************************************************/
+
+// Video player: the logo, then bmp.bin at its frame rate
+static FIL fil;
+static Player player;
+
+static void play_task(void)
+{
+    static u8 state = 0;            // 0: logo, 1: showing logo, 2: playing
+    static soft_timer wait;
+    FRESULT fr;
+    UINT br;
+
+    switch (state)
+    {
+    case 0:
+        fr = manifest_open(&fil, "logo.bin");
+        if (fr) printf("open error: %d!\n\r", (int)fr);
+        fr = f_read(&fil, image, sizeof(image), &br);
+        LCD_ShowPicture(0,0,159,39);
+        LEDB_TOG;
+        LCD_Sync();             // DMA may still be reading the buffer
+        fr = f_read(&fil, image, sizeof(image), &br);
+        LCD_ShowPicture(0,40,159,79);
+        LEDB_TOG;
+        f_close(&fil);
+        soft_timer_start(&wait, 1500);
+        state = 1;
+        break;
+    case 1:
+        if (!soft_timer_expired(&wait)) break;
+        fr = player_open(&player, "bmp.bin", PLAYER_FPS);
+        if (fr)
+        {
+            printf("open error: %d!\n\r", (int)fr);
+            state = 0;
+            break;
+        }
+        state = 2;
+        break;
+    case 2:
+        if (player_step(&player)) break;
+        /* Close the file, start over */
+        player_close(&player);
+        LEDB_TOG;
+        state = 0;
+        break;
+    }
+}
+
+// Font demo, one screen step per call
+static void demo_task(void)
+{
+    static int step = 0;
+    static soft_timer wait;
+    u32 pause = 1500;
+    u16 i;
+
+    if (!soft_timer_expired(&wait)) return;
+    switch (step)
+    {
+    case 0:
+        BACK_COLOR=BLACK;
+        LCD_Clear(BACK_COLOR);
+        LCD_ShowStringX(0,0,(u8 *)"Test Font 0", GREEN, 0);
+        pause = 500;
+        break;
+    case 1:
+        LCD_ShowStringX(0,8,(u8 *)"Test Font1", RED, 1);
+        pause = 500;
+        break;
+    case 2:
+        LCD_ShowStringX(0,24,(u8 *)"Test Font2", BLUE, 2);
+        pause = 500;
+        break;
+    case 3:
+        LCD_ShowStringX(0,48,(u8 *)"Test Font3", WHITE, 3);
+        break;
+    case 4:
+        LCD_Clear(BACK_COLOR);
+        LCD_ShowStringX(0,0,(u8 *)"Font4", GBLUE, 4);
+        break;
+    case 5:
+        LCD_ShowStringX(0,32,(u8 *)"Font5", WHITE,5);
+        break;
+    case 6:
+        LCD_Clear(BACK_COLOR);
+        LCD_ShowStringP(0,0,(u8 *)"Proportional 8px font, kerned: AVATAR", YELLOW, &PFont_Prop8);
+        LCD_ShowStringP(0,8,(u8 *)"Proportional 16px font", GREEN, &PFont_Prop16);
+        LCD_ShowStringP(0,24,(u8 *)"Tiny Lamps: AVATAR", WHITE, &PFont_Prop16);
+        LCD_ShowStringP(0,40,(u8 *)"Anti-aliased 8px font, 4 bits per pixel", WHITE, &PFont_Prop8AA);
+        LCD_ShowStringP(0,48,(u8 *)"Blended into any background color", GBLUE, &PFont_Prop8AA);
+        LCD_ShowStringX(0,64,(u8 *)"UTF-8: Grüße ☺ 25°C ½ €", YELLOW, 0);
+        break;
+    case 7+128+96:
+        LEDR_TOG;
+        break;
+    case 7+128+96+1:
+        LEDG_TOG;
+        break;
+    case 7+128+96+2:
+        LEDB_TOG;
+        step = -1;
+        break;
+    default:
+        if (step < 7+128)               // 128 characters, 16x16
+        {
+            i = step - 7;
+            LCD_printChar((i *16) % LCD_W, ((i * 16) / LCD_W *16) % LCD_H, i+32, WHITE, 2);
+            if (i < 127) pause = 50;
+        }
+        else                            // 96 characters, 8x16
+        {
+            i = step - (7+128);
+            LCD_printChar((i *8) % LCD_W, ((i * 8) / LCD_W *16) % LCD_H, i+32, GBLUE, 1);
+            if (i < 95) pause = 50;
+        }
+        break;
+    }
+    step++;
+    soft_timer_start(&wait, pause);
+}
+
+static Logger telemetry;
+static u8 telemetry_ok;
+
+// Load and display statistics over UART, and log them to the card
+static void status_task(void)
+{
+    static u8 n;
+    u16 idle = idle_permille();
+
+    printf("idle %u.%u%%, busy %u.%u%%\n\r", idle / 10, idle % 10, (1000 - idle) / 10, (1000 - idle) % 10);
+    if (telemetry_ok)
+    {
+        char rec[24];
+        int len = snprintf(rec, sizeof(rec), "%lu %u\n", systick_ms, idle);
+        if (log_write(&telemetry, rec, len)) telemetry_ok = 0;
+    }
+    if (++n < 10) return;
+    n = 0;
+    {
+        const LCD_WindowStats *ws = LCD_Window_Stats();
+        printf("LCD windows: %lu, CASET %lu, RASET %lu, skipped %lu\n\r",
+               ws->windows, ws->caset, ws->raset, ws->saved);
+    }
+    {
+        const BlkCacheStats *bs = blkcache_stats();
+        printf("sector cache: hits %lu, misses %lu, evictions %lu, bypass %lu\n\r",
+               bs->hits, bs->misses, bs->evictions, bs->bypass);
+    }
+    {
+        const SdErrStats *es = disk_err_stats();
+        printf("TF card: SPI %lu kHz, CRC errors %lu data, %lu cmd, retries %lu, failed %lu, slowdowns %lu\n\r",
+               disk_spi_clock() / 1000, es->crc_data, es->crc_cmd, es->retries, es->failed, es->slowdowns);
+    }
+    if (telemetry_ok)
+        printf("log: %lu bytes, %lu sectors, %lu syncs\n\r", telemetry.bytes, telemetry.sectors, telemetry.syncs);
+}
+
 int main(void)
 {
     uint8_t mount_is_ok = 1; /* 0: mount successful ; 1: mount failed */
-    int offset = 0;
-    FIL fil;
     FRESULT fr;     /* FatFs return code */
-    UINT br;
 
     rcu_periph_clock_enable(RCU_GPIOA);
     rcu_periph_clock_enable(RCU_GPIOC);
     gpio_init(GPIOC, GPIO_MODE_OUT_PP, GPIO_OSPEED_50MHZ, GPIO_PIN_13);
     gpio_init(GPIOA, GPIO_MODE_OUT_PP, GPIO_OSPEED_50MHZ, GPIO_PIN_1|GPIO_PIN_2);
 
+    BootProf_Mark("main");
+    systick_init();     // 1ms tick: card timeouts, soft timers, scheduler
+    idle_init();
     init_uart0();
+    // Display and card init take turns: each step does a little work and
+    // returns, so the card's ACMD41 polling runs while the panel sits out
+    // its reset and sleep-out delays.
+    {
+        int lcd_busy = 1, sd_busy = 1;
+        while (lcd_busy || sd_busy)
+        {
+            if (lcd_busy) lcd_busy = Lcd_Init_Step();
+            if (sd_busy) sd_busy = disk_init_step();
+        }
+    }
+    BootProf_Mark("lcd+sd init");
+
+    fr = f_mount(&fs, "", 1);	// The card is up already
+    if (fr == 0)
+    {
+        mount_is_ok = 0;
+        // Keep the FAT (and a FAT12/16 root directory) in the sector cache
+        blkcache_pin(fs.fatbase, fs.fsize);      // FatFs reads the first FAT only
+        if (fs.fs_type != FS_FAT32) blkcache_pin(fs.dirbase, fs.database - fs.dirbase);
+    }
+    else
+        mount_is_ok = 1;
+    BootProf_Mark("f_mount");
+    if (!mount_is_ok)
+    {
+        BYTE type = 0;
+        disk_ioctl(0, MMC_GET_TYPE, &type);
+        printf("TF card: SPI %lu kHz%s\n\r", disk_spi_clock() / 1000, (type & CT_HS) ? ", high-speed mode" : "");
+        fr = manifest_load("assets.mf");    // Asset start clusters, see tools/mkmanifest.py
+        if (fr) printf("assets.mf: not used (%d)\n\r", (int)fr);
+    }
 
-    Lcd_Init();			// init OLED
+#if LCD_BUS_BENCH
+    {
+        u32 per_byte, burst, n = LCD_W*LCD_H*2;
+        LCD_Bus_Bench(&per_byte, &burst);
+        per_byte = per_byte * 100 / n;      // Hundredths of a tick per byte
+        burst = burst * 100 / n;
+        printf("LCD bus, ticks per byte: old per-byte CS %lu.%02lu, burst %lu.%02lu\n\r",
+               per_byte / 100, per_byte % 100, burst / 100, burst % 100);
+    }
+#endif
     LCD_Clear(WHITE);
     BACK_COLOR=WHITE;
+    LCD_Sync();
+    BootProf_Mark("first frame");
+    BootProf_Report();
 
     LEDR(1);
     LEDG(1);
     LEDB(1);
 
-    fr = f_mount(&fs, "", 1);
-    if (fr == 0)
-        mount_is_ok = 0;
-    else
-        mount_is_ok = 1;
-
+    // Polled every millisecond; in between the core sleeps
     if (mount_is_ok == 0)
-    {
-        while(1)
-        {
-            offset = 0;
-            fr = f_open(&fil, "logo.bin", FA_READ);
-            if (fr) printf("open error: %d!\n\r", (int)fr);
-            f_lseek(&fil, offset);
-            fr = f_read(&fil, image, sizeof(image), &br);
-            LCD_ShowPicture(0,0,159,39);
-            offset += 12800;
-            LEDB_TOG;
-            f_lseek(&fil, offset);
-            fr = f_read(&fil, image, sizeof(image), &br);
-            LCD_ShowPicture(0,40,159,79);
-            LEDB_TOG;
-            delay_1ms(1500);
-            f_close(&fil);
-
-            fr = f_open(&fil, "bmp.bin", FA_READ);
-            if (fr) printf("open error: %d!\n\r", (int)fr);
-            offset = 0;
-
-            for (int i=0; i<2189;i++)
-            {
-                fr = f_read(&fil, image, sizeof(image), &br);
-                LCD_ShowPicture(0,0,159,39);
-                offset += 12800;
-                f_lseek(&fil, offset);
-                LEDB_TOG;
-                fr = f_read(&fil, image, sizeof(image), &br);
-                LCD_ShowPicture(0,40,159,79);
-                offset += 12800;
-                f_lseek(&fil, offset);
-                LEDB_TOG;
-            }
-
-
-            /* Close the file */
-            f_close(&fil);
-        }
-    }
+        telemetry_ok = (log_open(&telemetry, "telemetry.log") == FR_OK);
+    if (mount_is_ok == 0)
+        sched_add(play_task, 1);
     else
-    {
-        while(1)
-        {
-            BACK_COLOR=BLACK;
-            LCD_Clear(BACK_COLOR);
-            LCD_ShowStringX(0,0,(u8 *)"Test Font 0", GREEN, 0);
-            delay_1ms(500);
-            LCD_ShowStringX(0,8,(u8 *)"Test Font1", RED, 1);
-            delay_1ms(500);
-            LCD_ShowStringX(0,24,(u8 *)"Test Font2", BLUE, 2);
-            delay_1ms(500);
-            LCD_ShowStringX(0,48,(u8 *)"Test Font3", WHITE, 3);
-            delay_1ms(1500);
-            
-            LCD_Clear(BACK_COLOR);
-            LCD_ShowStringX(0,0,(u8 *)"Font4", GBLUE, 4);
-            delay_1ms(1500);
-            LCD_ShowStringX(0,32,(u8 *)"Font5", WHITE,5);
-            
-            
-            
-            delay_1ms(1500);
-            for(u16 i=0;i<128;i++)
-            {
-                u16 x = (i *16) % LCD_W;
-                u16 y = ((i * 16) / LCD_W *16) % LCD_H; 
-                LCD_printChar(x,y,i+32,WHITE,2);
-                delay_1ms(50);
-            }
-
-            delay_1ms(1500);
-            for(u16 i=0;i<96;i++)
-            {
-                u16 x = (i *8) % LCD_W;
-                u16 y = ((i * 8) / LCD_W *16) % LCD_H; 
-                LCD_printChar(x,y,i+32,GBLUE,1);
-                delay_1ms(50);
-            }
-
-            
-            LEDR_TOG;
-            delay_1ms(1500);
-            LEDG_TOG;
-            delay_1ms(1500);
-            LEDB_TOG;
-            delay_1ms(1500);
-        
-        }
-    }
+        sched_add(demo_task, 1);
+    sched_add(status_task, 1000);
+    sched_run();
 }
 
 int _put_char(int ch)
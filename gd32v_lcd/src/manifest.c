@@ -0,0 +1,106 @@
+/**************************************************************************
+ * Asset manifest
+ * Code CC-BY untergeekDE
+ *
+ * f_open walks the path one directory at a time and searches each
+ * directory for the name. The assets never move, so their start
+ * clusters can be looked up once, on the PC (tools/mkmanifest.py), and
+ * stored in a file on the card. After manifest_load, an asset is opened
+ * with f_open_at: no directory sector is read.
+ *
+ * The manifest belongs to one volume: the serial number and the cluster
+ * count must match, or it is not used. Formatting the card changes the
+ * serial number; rewriting an asset does not, hence the tool has to run
+ * again after that.
+ *
+ * Contiguous assets also get a one-fragment cluster link map (fast seek),
+ * so f_lseek and f_read compute the cluster instead of following the FAT.
+ * *******************************************************************************/
+
+#include <string.h>
+#include "manifest.h"
+
+typedef struct {
+	ManifestEntry e;
+	DWORD map[4];					// Link map: size, clusters, start cluster, end
+} ManifestAsset;
+
+static ManifestAsset manifest[MANIFEST_MAX];
+static UINT manifest_count;
+
+/******************************************************************************
+       Function description: read the manifest and check it against the volume
+       Entry data: manifest file name
+       Return value: FatFs result; FR_INVALID_OBJECT for a file that is no
+                     manifest or one made for another volume
+******************************************************************************/
+FRESULT manifest_load(const char *path)
+{
+	ManifestHeader hdr;
+	FIL fil;
+	FATFS *fs;
+	DWORD vsn, bcs;
+	UINT br, i;
+	FRESULT fr;
+
+	manifest_count = 0;
+	fr = f_open(&fil, path, FA_READ);
+	if (fr) return fr;
+	fs = fil.obj.fs;
+	fr = f_read(&fil, &hdr, sizeof(hdr), &br);
+	if (!fr && (br < sizeof(hdr) || hdr.magic != MANIFEST_MAGIC || hdr.clusters != fs->n_fatent - 2))
+		fr = FR_INVALID_OBJECT;
+	if (!fr) fr = f_getvsn("", &vsn);
+	if (!fr && vsn != hdr.vsn) fr = FR_INVALID_OBJECT;
+	if (!fr && hdr.count > MANIFEST_MAX) hdr.count = MANIFEST_MAX;	// The rest goes through f_open
+	bcs = (DWORD)fs->csize * 512;
+	for (i = 0; !fr && i < hdr.count; i++)
+	{
+		ManifestAsset *a = &manifest[i];
+		fr = f_read(&fil, &a->e, sizeof(a->e), &br);
+		if (!fr && br < sizeof(a->e)) fr = FR_INVALID_OBJECT;
+		a->e.name[MANIFEST_NAME - 1] = 0;
+		a->map[0] = 4;
+		a->map[1] = (a->e.size + bcs - 1) / bcs;
+		a->map[2] = a->e.sclust;
+		a->map[3] = 0;
+	}
+	f_close(&fil);
+	if (!fr) manifest_count = hdr.count;
+	return fr;
+}
+
+// Names are compared without case, like FAT does
+static int manifest_match(const char *a, const char *b)
+{
+	for (; *a && *b; a++, b++)
+	{
+		char c = (*b >= 'a' && *b <= 'z') ? *b - 'a' + 'A' : *b;
+		if (*a != c) return 0;
+	}
+	return *a == *b;
+}
+
+/******************************************************************************
+       Function description: open an asset for reading
+       From the manifest when it lists the name, else with f_open.
+       Entry data: file object, file name
+       Return value: FatFs result
+******************************************************************************/
+FRESULT manifest_open(FIL *fp, const char *name)
+{
+	FRESULT fr;
+	UINT i;
+
+	while (*name == '/') name++;
+	for (i = 0; i < manifest_count; i++)
+	{
+		ManifestAsset *a = &manifest[i];
+		if (!manifest_match(a->e.name, name)) continue;
+		fr = f_open_at(fp, "", a->e.sclust, a->e.size);
+		if (!fr && (a->e.flags & MANIFEST_CONTIG) && a->e.sclust)
+			fp->cltbl = a->map;		// Fast seek: one fragment
+		return fr;
+	}
+	return f_open(fp, name, FA_READ);
+}
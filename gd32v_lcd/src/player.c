@@ -0,0 +1,123 @@
+/**************************************************************************
+ * Frame-paced video player
+ * Code CC-BY untergeekDE
+ *
+ * Frame n is due at t0 + n * period (mtime). A frame goes out in four
+ * bands (20 rows of 160x80) through the two halves of the image buffer:
+ * while DMA sends one half to the display, the card fills the other.
+ * Frames are drawn unscaled, so the display has to be 160x80 (landscape).
+ *
+ * Pacing, at the start of every frame:
+ * - too early: wait (return, the scheduler sleeps in between)
+ * - a whole period late or more: skip to the frame that is due now.
+ *   Frames have a fixed size, so its file offset is frame * FRAME_SIZE,
+ *   one f_lseek and no reading through the frames in between.
+ * A frame whose last band is queued after the next frame is due counts
+ * as late. Once a second the counters go out over UART.
+ * *******************************************************************************/
+
+#include <stdio.h>
+#include "player.h"
+#include "manifest.h"
+#include "systick.h"
+
+#define PLAYER_W        160                             // Frame width of the files
+#define PLAYER_H        (FRAME_SIZE / 2 / PLAYER_W)     // Frame height (RGB565)
+#define PLAYER_BANDS    4
+#define PLAYER_BAND     (FRAME_SIZE / PLAYER_BANDS)     // Bytes per band: half the image buffer
+#define PLAYER_ROWS     (PLAYER_H / PLAYER_BANDS)       // Rows per band
+
+#if PLAYER_H % PLAYER_BANDS
+#error A band has to be whole rows
+#endif
+
+/******************************************************************************
+       Function description: open a frame file and start the clock
+       The file is opened through the asset manifest (manifest.h).
+       Entry data: player, file name, frames per second
+       Return value: FatFs result; FR_INVALID_PARAMETER if the display
+       is not PLAYER_W x PLAYER_H in its current orientation
+******************************************************************************/
+FRESULT player_open(Player *p, const char *path, uint16_t fps)
+{
+	FRESULT fr;
+
+	if (LCD_W != PLAYER_W || LCD_H != PLAYER_H) return FR_INVALID_PARAMETER;
+	fr = manifest_open(&p->fil, path);
+	if (fr) return fr;
+	p->frames = f_size(&p->fil) / FRAME_SIZE;
+	p->frame = 0;
+	p->band = 0;
+	p->period = SystemCoreClock / 4 / fps;
+	p->t0 = get_timer_value();
+	p->shown = p->late = p->dropped = 0;
+	p->report = systick_ms + 1000;
+	return FR_OK;
+}
+
+void player_close(Player *p)
+{
+	LCD_Sync();						// DMA may still read the buffer
+	f_close(&p->fil);
+}
+
+// Once a second: what happened
+static void player_report(Player *p)
+{
+	if ((int32_t)(systick_ms - p->report) < 0) return;
+	p->report += 1000;
+	printf("play: frame %lu, shown %lu, late %lu, dropped %lu\n\r",
+	       p->frame, p->shown, p->late, p->dropped);
+	p->shown = p->late = p->dropped = 0;
+}
+
+/******************************************************************************
+       Function description: do the next bit of playback
+       Loads at most one band per call, and only when a buffer half is free.
+       Entry data: player
+       Return value: 1 while playing, 0 at the end (or on a read error)
+******************************************************************************/
+int player_step(Player *p)
+{
+	uint64_t now = get_timer_value();
+	u8 *half;
+	UINT br;
+
+	player_report(p);
+	if (p->band == 0)
+	{
+		uint32_t due = (now - p->t0) / p->period;	// Frame that should be up now
+		if (p->frame > due)							// Early: wait
+		{
+			disk_prefetch();						// ...and let the card send ahead
+			return 1;
+		}
+		if (p->frame < due)							// Late by a frame or more: skip
+		{
+			p->dropped += due - p->frame;
+			p->frame = due;
+			if (p->frame >= p->frames) return 0;
+			if (f_lseek(&p->fil, (FSIZE_t)p->frame * FRAME_SIZE)) return 0;
+		}
+		if (p->frame >= p->frames) return 0;
+		if (LCD_W != PLAYER_W || LCD_H != PLAYER_H) return 0;	// Rotated while playing
+	}
+
+	if (LCD_Pending() > 1)							// This half is still being sent
+	{
+		disk_prefetch();
+		return 1;
+	}
+	half = image + (p->band & 1) * PLAYER_BAND;
+	if (f_read(&p->fil, half, PLAYER_BAND, &br) || br < PLAYER_BAND) return 0;
+	LCD_QueuePicture(0, p->band * PLAYER_ROWS, PLAYER_W - 1, p->band * PLAYER_ROWS + PLAYER_ROWS - 1, half);
+
+	if (++p->band == PLAYER_BANDS)
+	{
+		p->band = 0;
+		p->shown++;
+		if (get_timer_value() > p->t0 + (uint64_t)(p->frame + 1) * p->period) p->late++;
+		p->frame++;
+	}
+	return 1;
+}
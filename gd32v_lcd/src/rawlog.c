@@ -0,0 +1,115 @@
+/**************************************************************************
+ * Pre-allocated, contiguous log files
+ * Code CC-BY untergeekDE
+ *
+ * Appending with f_write allocates clusters on the way (create_chain
+ * scans the FAT for a free one) and updates the FAT and directory on each
+ * f_sync: the time per write depends on the state of the card. Here all
+ * of that happens once, in rawlog_open. A write is then one disk_write
+ * to a computed LBA, plus a one-sector header update every
+ * RAWLOG_HDR_EVERY sectors.
+ *
+ * The file's size in the directory is its full capacity from the start;
+ * readers take the fill level from the header. After a power failure,
+ * at most RAWLOG_HDR_EVERY sectors beyond the header's count are lost.
+ *
+ * An existing file is only used if its clusters are still one block: a
+ * copy or a defragmenter on the PC may have moved it, and raw writes to
+ * a fragmented file would land in other files' clusters.
+ * *******************************************************************************/
+
+#include <string.h>
+#include "rawlog.h"
+
+#if !FF_USE_FASTSEEK
+#error rawlog.c checks the cluster chain with a link map: FF_USE_FASTSEEK must be 1
+#endif
+
+static BYTE rawlog_sec[512];		// Header sector buffer
+
+/******************************************************************************
+       Function description: open a log file, or create and pre-allocate it
+       Entry data: log, file name, data sectors (used when creating)
+       Return value: FatFs result; FR_DENIED when there is no contiguous
+                     space, FR_INVALID_OBJECT for a file that is no raw log
+                     or is not contiguous (any more)
+******************************************************************************/
+FRESULT rawlog_open(RawLog *rl, const char *path, DWORD sectors)
+{
+	FIL fil;
+	FATFS *fs;
+	DWORD map[4];
+	FRESULT fr;
+
+	fr = f_open(&fil, path, FA_READ | FA_WRITE | FA_OPEN_ALWAYS);
+	if (fr) return fr;
+	fs = fil.obj.fs;
+	if (f_size(&fil) == 0)
+	{
+		// New file: one contiguous block, header plus data
+		fr = f_expand(&fil, (FSIZE_t)(sectors + 1) * 512, 1);
+		if (fr) goto fail;
+		rl->hdr.magic = RAWLOG_MAGIC;
+		rl->hdr.sectors = sectors;
+		rl->hdr.fill = 0;
+		rl->hdr.seq = 0;
+	}
+	else
+	{
+		UINT br;
+		fr = f_read(&fil, rawlog_sec, 512, &br);
+		if (fr) goto fail;
+		memcpy(&rl->hdr, rawlog_sec, sizeof(rl->hdr));
+		if (br < 512 || rl->hdr.magic != RAWLOG_MAGIC
+			|| (FSIZE_t)(rl->hdr.sectors + 1) * 512 > f_size(&fil))
+		{
+			fr = FR_INVALID_OBJECT;
+			goto fail;
+		}
+	}
+	// One fragment covering header and data, or raw writes would hit other files
+	map[0] = 4;
+	fil.cltbl = map;
+	fr = f_lseek(&fil, CREATE_LINKMAP);
+	if (fr == FR_NOT_ENOUGH_CORE
+		|| (!fr && (DWORD)map[1] * fs->csize < rl->hdr.sectors + 1))
+		fr = FR_INVALID_OBJECT;
+	if (fr) goto fail;
+	rl->lba = fs->database + (fil.obj.sclust - 2) * fs->csize;
+	rl->unsaved = 0;
+	fr = f_close(&fil);
+	if (fr) return fr;
+	return rawlog_sync(rl);
+
+fail:
+	f_close(&fil);
+	return fr;
+}
+
+/******************************************************************************
+       Function description: rewrite the header sector
+******************************************************************************/
+FRESULT rawlog_sync(RawLog *rl)
+{
+	rl->hdr.seq++;
+	memset(rawlog_sec, 0, sizeof(rawlog_sec));
+	memcpy(rawlog_sec, &rl->hdr, sizeof(rl->hdr));
+	if (disk_write(0, rawlog_sec, rl->lba, 1)) return FR_DISK_ERR;
+	rl->unsaved = 0;
+	return FR_OK;
+}
+
+/******************************************************************************
+       Function description: append whole sectors
+       Entry data: log, data, number of sectors
+       Return value: FatFs result; FR_DENIED when the file is full
+******************************************************************************/
+FRESULT rawlog_write(RawLog *rl, const BYTE *buff, UINT count)
+{
+	if (count > rl->hdr.sectors - rl->hdr.fill) return FR_DENIED;
+	if (disk_write(0, buff, rl->lba + 1 + rl->hdr.fill, count)) return FR_DISK_ERR;
+	rl->hdr.fill += count;
+	rl->unsaved += count;
+	if (rl->unsaved >= RAWLOG_HDR_EVERY) return rawlog_sync(rl);
+	return FR_OK;
+}
@@ -0,0 +1,61 @@
+/**************************************************************************
+ * Cooperative task scheduler
+ * Code CC-BY untergeekDE
+ *
+ * Round robin over a fixed table of tasks, driven by the 1ms systick.
+ * A task with a period runs when its time has come; the next due time
+ * is counted from the previous one, so periods don't drift.
+ * Tasks with period 0 run on every pass (pollers like the video player).
+ * When no task was due, the core sleeps until the next interrupt.
+ * *******************************************************************************/
+
+#include "sched.h"
+#include "systick.h"
+#include "idle.h"
+
+static struct {
+	sched_fn fn;
+	uint32_t period;
+	uint32_t next;				// systick_ms when it is due
+} sched_tasks[SCHED_TASKS];
+static uint8_t sched_count;
+
+/******************************************************************************
+       Function description: add a task
+       Entry data: function, period in ms (0: every pass)
+       Return value: 0 ok, -1 table full
+******************************************************************************/
+int sched_add(sched_fn fn, uint32_t period_ms)
+{
+	if (sched_count >= SCHED_TASKS) return -1;
+	sched_tasks[sched_count].fn = fn;
+	sched_tasks[sched_count].period = period_ms;
+	sched_tasks[sched_count].next = systick_ms;
+	sched_count++;
+	return 0;
+}
+
+/******************************************************************************
+       Function description: run the tasks, forever
+       Needs systick_init().
+******************************************************************************/
+void sched_run(void)
+{
+	while (1)
+	{
+		uint8_t ran = 0;
+		for (uint8_t i = 0; i < sched_count; i++)
+		{
+			if (sched_tasks[i].period)
+			{
+				if ((int32_t)(systick_ms - sched_tasks[i].next) < 0) continue;
+				sched_tasks[i].next += sched_tasks[i].period;
+				if ((int32_t)(systick_ms - sched_tasks[i].next) >= 0)
+					sched_tasks[i].next = systick_ms + sched_tasks[i].period;	// Way late: don't catch up
+			}
+			sched_tasks[i].fn();
+			ran = 1;
+		}
+		if (!ran) idle_wait();		// Nothing due: sleep until the tick (or DMA)
+	}
+}
@@ -33,7 +33,77 @@ OF SUCH DAMAGE.
 */
 
 #include "gd32vf103.h"
+#include "n200_func.h"
 #include "systick.h"
+#include "idle.h"
+
+volatile uint32_t systick_ms;
+static uint32_t tick_mtime;                     /* mtime ticks per millisecond */
+static uint64_t tick_next;                      /* mtime of the next tick */
+static uint8_t tick_running;                    /* something will wake us from WFI */
+static void (*tick_hooks[SYSTICK_HOOKS])(void);
+
+/* set the next compare value; the high word first, so that no
+   half-written value can fire early */
+static void mtimecmp_set(uint64_t t)
+{
+    volatile uint32_t *cmp = (volatile uint32_t *)(TIMER_CTRL_ADDR + TIMER_MTIMECMP);
+
+    cmp[0] = 0xFFFFFFFFU;
+    cmp[1] = (uint32_t)(t >> 32);
+    cmp[0] = (uint32_t)t;
+}
+
+/*!
+    \brief      start the 1ms tick (machine timer compare interrupt)
+    \param[in]  none
+    \param[out] none
+    \retval     none
+*/
+void systick_init(void)
+{
+    tick_mtime = SystemCoreClock / 4000U;       /* mtime runs at core clock / 4 */
+    tick_next = get_timer_value() + tick_mtime;
+    mtimecmp_set(tick_next);
+
+    eclic_priority_group_set(ECLIC_PRIGROUP_LEVEL3_PRIO1);
+    eclic_irq_enable(CLIC_INT_TMR, 1, 1);
+    eclic_global_interrupt_enable();
+    tick_running = 1;
+}
+
+/*!
+    \brief      call a function from the tick interrupt, every millisecond
+    \param[in]  fn: function, must be short
+    \param[out] none
+    \retval     0: ok, -1: no free slot
+*/
+int systick_add_hook(void (*fn)(void))
+{
+    for (int i = 0; i < SYSTICK_HOOKS; i++) {
+        if (tick_hooks[i] == fn) return 0;
+        if (!tick_hooks[i]) {
+            tick_hooks[i] = fn;
+            return 0;
+        }
+    }
+    return -1;
+}
+
+/*!
+    \brief      machine timer interrupt: one millisecond passed
+    \param[in]  none
+    \param[out] none
+    \retval     none
+*/
+void eclic_mtip_handler(void)
+{
+    /* next compare: one period after the last one, so the tick does not drift */
+    tick_next += tick_mtime;
+    mtimecmp_set(tick_next);
+    systick_ms++;
+    for (int i = 0; i < SYSTICK_HOOKS && tick_hooks[i]; i++) tick_hooks[i]();
+}
 
 /*!
     \brief      delay a time in milliseconds
@@ -43,15 +113,41 @@ OF SUCH DAMAGE.
 */
 void delay_1ms(uint32_t count)
 {
-	uint64_t start_mtime, delta_mtime;
+    uint64_t start_mtime, ticks;
+
+    /* integer math, worked out once (works with or without the tick running) */
+    ticks = (uint64_t)(SystemCoreClock / 4000U) * count;
+
+    /* Don't start measuring until we see an mtime tick */
+    uint64_t tmp = get_timer_value();
+    do {
+        start_mtime = get_timer_value();
+    } while (start_mtime == tmp);
+
+    while (get_timer_value() - start_mtime < ticks) {
+        if (tick_running) idle_wait();          /* sleep, the tick wakes us up */
+    }
+}
 
-	// Don't start measuruing until we see an mtime tick
-	uint64_t tmp = get_timer_value();
-	do {
-	start_mtime = get_timer_value();
-	} while (start_mtime == tmp);
+/*!
+    \brief      start a non-blocking timer
+    \param[in]  t: timer, ms: time until it expires
+    \param[out] none
+    \retval     none
+*/
+void soft_timer_start(soft_timer *t, uint32_t ms)
+{
+    t->start = systick_ms;
+    t->ms = ms;
+}
 
-	do {
-	delta_mtime = get_timer_value() - start_mtime;
-	}while(delta_mtime <(SystemCoreClock/4000.0 *count ));
+/*!
+    \brief      has the timer expired? (needs systick_init)
+    \param[in]  t: timer
+    \param[out] none
+    \retval     1: expired, 0: still running
+*/
+int soft_timer_expired(const soft_timer *t)
+{
+    return (systick_ms - t->start) >= t->ms;
 }
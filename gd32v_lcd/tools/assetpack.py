@@ -0,0 +1,154 @@
+#!/usr/bin/env python3
+"""
+assetpack.py - pack images into the flash asset store (see include/lcd/asset.h).
+
+Usage:
+    python3 tools/assetpack.py -o include/lcd \
+        LOGO=assets/logo.bin:160x80
+
+Every argument is NAME=FILE[:WxH][:codec]:
+- FILE is either raw RGB565, high byte first (the format the panel takes,
+  and the one logo.bin/bmp.bin on the TF card use; WxH is required),
+  or an uncompressed 24-bit .bmp (size is taken from the file).
+- codec is "rle" (default) or "raw". If RLE does not make an asset
+  smaller, it is stored raw.
+
+Two headers come out:
+- assets.h:      the ASSET_<NAME> ids, for the application,
+- assets_data.h: the packed bytes and the asset table, included by asset.c only.
+
+RLE format, on 16-bit pixels (PackBits style):
+    control byte c < 0x80:  c+1 literal pixels follow (2 bytes each)
+    control byte c >= 0x80: the next pixel repeats (c & 0x7F)+1 times
+"""
+
+import argparse
+import os
+import struct
+import sys
+
+CODEC_RAW, CODEC_RLE = 0, 1
+
+
+def load_bmp(path):
+    data = open(path, "rb").read()
+    if data[:2] != b"BM":
+        sys.exit("%s: not a BMP file" % path)
+    off, = struct.unpack_from("<I", data, 10)
+    w, h, planes, bpp, comp = struct.unpack_from("<iiHHI", data, 18)
+    if bpp != 24 or comp != 0:
+        sys.exit("%s: only uncompressed 24-bit BMP is supported" % path)
+    flip = h > 0
+    h = abs(h)
+    stride = (w * 3 + 3) & ~3
+    px = []
+    for y in range(h):
+        row = off + ((h - 1 - y) if flip else y) * stride
+        for x in range(w):
+            b, g, r = data[row + 3 * x:row + 3 * x + 3]
+            px.append(((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3))
+    return w, h, px
+
+
+def load_raw(path, w, h):
+    data = open(path, "rb").read()
+    if len(data) != w * h * 2:
+        sys.exit("%s: %d bytes, expected %d for %dx%d" % (path, len(data), w * h * 2, w, h))
+    return [(data[i] << 8) | data[i + 1] for i in range(0, len(data), 2)]
+
+
+def rle16(px):
+    out = bytearray()
+    i, n = 0, len(px)
+    while i < n:
+        run = 1
+        while i + run < n and run < 128 and px[i + run] == px[i]:
+            run += 1
+        if run >= 2:
+            out.append(0x80 | (run - 1))
+            out += struct.pack(">H", px[i])
+            i += run
+            continue
+        j = i + 1                   # literals until the next run of 2+
+        while j < n and j - i < 128 and not (j + 1 < n and px[j] == px[j + 1]):
+            j += 1
+        out.append(j - i - 1)
+        for p in px[i:j]:
+            out += struct.pack(">H", p)
+        i = j
+    return bytes(out)
+
+
+def parse_spec(spec):
+    if "=" not in spec:
+        sys.exit("bad asset '%s', expected NAME=FILE[:WxH][:codec]" % spec)
+    name, rest = spec.split("=", 1)
+    parts = rest.split(":")
+    path, size, codec = parts[0], None, "rle"
+    for p in parts[1:]:
+        if "x" in p:
+            size = tuple(int(v) for v in p.split("x"))
+        else:
+            codec = p
+    if codec not in ("rle", "raw"):
+        sys.exit("%s: unknown codec '%s'" % (name, codec))
+    return name.upper(), path, size, codec
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__.split("\n")[1])
+    ap.add_argument("-o", "--outdir", required=True)
+    ap.add_argument("assets", nargs="+")
+    args = ap.parse_args()
+
+    blob = bytearray()
+    table = []
+    for spec in args.assets:
+        name, path, size, codec = parse_spec(spec)
+        if path.lower().endswith(".bmp"):
+            w, h, px = load_bmp(path)
+        else:
+            if not size:
+                sys.exit("%s: raw image needs WxH" % name)
+            w, h = size
+            px = load_raw(path, w, h)
+        raw = b"".join(struct.pack(">H", p) for p in px)
+        packed, kind = raw, CODEC_RAW
+        if codec == "rle":
+            r = rle16(px)
+            if len(r) < len(raw):
+                packed, kind = r, CODEC_RLE
+        table.append((name, len(blob), len(packed), w, h, kind, len(raw), os.path.basename(path)))
+        blob += packed
+
+    ids = ["// Generated by tools/assetpack.py - do not edit.", "",
+           "#ifndef __ASSETS_H", "#define __ASSETS_H", "", "enum {"]
+    for name, off, size, w, h, kind, rawlen, src in table:
+        ids.append("\tASSET_%s,\t// %s, %dx%d, %d of %d bytes"
+                   % (name, src, w, h, size, rawlen))
+    ids += ["\tASSET_COUNT", "};", "", "#endif", ""]
+
+    d = ["// Generated by tools/assetpack.py - do not edit.",
+         "// %d assets, %d bytes packed, %d bytes unpacked"
+         % (len(table), len(blob), sum(t[6] for t in table)), "",
+         "#ifndef __ASSETS_DATA_H", "#define __ASSETS_DATA_H", "",
+         '#include "lcd/asset.h"', "",
+         "static const uint8_t asset_blob[%d] = {" % max(len(blob), 1)]
+    for i in range(0, len(blob), 16):
+        d.append("\t" + ",".join("0x%02X" % b for b in blob[i:i + 16]) + ",")
+    d += ["};", "", "static const Asset asset_table[ASSET_COUNT] = {"]
+    codecs = {CODEC_RAW: "ASSET_CODEC_RAW", CODEC_RLE: "ASSET_CODEC_RLE"}
+    for name, off, size, w, h, kind, rawlen, src in table:
+        d.append("\t{ %6d, %6d, %3d, %3d, %s },\t// ASSET_%s" % (off, size, w, h, codecs[kind], name))
+    d += ["};", "", "#endif", ""]
+
+    with open(os.path.join(args.outdir, "assets.h"), "w") as f:
+        f.write("\n".join(ids))
+    with open(os.path.join(args.outdir, "assets_data.h"), "w") as f:
+        f.write("\n".join(d))
+    for name, off, size, w, h, kind, rawlen, src in table:
+        print("ASSET_%-12s %3dx%-3d %6d -> %6d bytes" % (name, w, h, rawlen, size))
+
+
+if __name__ == "__main__":
+    main()
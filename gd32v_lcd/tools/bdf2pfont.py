@@ -0,0 +1,233 @@
+#!/usr/bin/env python3
+"""
+bdf2pfont.py - compile a BDF bitmap font into a packed proportional font
+for the LCD library (see include/lcd/pfont.h).
+
+Usage:
+    python3 tools/bdf2pfont.py fonts/prop16.bdf -n PFont_Prop16 \
+        -k fonts/prop16.kern -o include/lcd/pfont_prop16.h
+
+What comes out is a C header with three const tables and one PFont struct:
+- the glyph bitmaps, column by column, LSB on top (the same layout as the
+  BasicFont in 8x8_vertikal_LSB_2.h), ceil(height*bpp/8) bytes per column,
+- one PFontGlyph per character: bitmap offset, width, advance, x offset,
+- the kerning pairs, sorted by (left, right) so the renderer can
+  binary-search them.
+
+Empty columns left and right of the ink are cropped; the pen advance
+(DWIDTH) is kept as it is in the BDF.
+
+Anti-aliased fonts: with --bpp 2 or 4 every pixel holds a coverage value
+instead of a bit, top pixel in the lowest bits of the column. They are made
+by shrinking a larger BDF with --scale N: each output pixel covers N x N
+source pixels and stores how many of them are inked. Advances and kerning
+shrink along.
+
+The kerning file is plain text, one pair per line: two characters and
+a signed pixel adjustment, e.g. "AV -1". Lines starting with # are ignored.
+"""
+
+import argparse
+import sys
+
+
+def parse_bdf(path):
+    """Return (ascent, descent, {encoding: glyph}) for a BDF file."""
+    ascent = descent = None
+    glyphs = {}
+    cur = None
+    in_bitmap = False
+    with open(path, encoding="latin-1") as f:
+        for line in f:
+            words = line.split()
+            if not words:
+                continue
+            key = words[0]
+            if in_bitmap:
+                if key == "ENDCHAR":
+                    in_bitmap = False
+                    if cur["enc"] >= 0:
+                        glyphs[cur["enc"]] = cur
+                    cur = None
+                else:
+                    cur["rows"].append(int(key, 16))
+                continue
+            if key == "FONT_ASCENT":
+                ascent = int(words[1])
+            elif key == "FONT_DESCENT":
+                descent = int(words[1])
+            elif key == "STARTCHAR":
+                cur = {"name": " ".join(words[1:]), "enc": -1, "dwidth": 0,
+                       "bbx": (0, 0, 0, 0), "rows": []}
+            elif key == "ENCODING":
+                cur["enc"] = int(words[1])
+            elif key == "DWIDTH":
+                cur["dwidth"] = int(words[1])
+            elif key == "BBX":
+                cur["bbx"] = tuple(int(w) for w in words[1:5])
+            elif key == "BITMAP":
+                in_bitmap = True
+    if ascent is None or descent is None:
+        sys.exit("%s: FONT_ASCENT/FONT_DESCENT missing" % path)
+    return ascent, descent, glyphs
+
+
+def glyph_pixels(g, ascent, height):
+    """Return a dict {(x, row): 1} of set pixels, x relative to the pen."""
+    w, h, xo, yo = g["bbx"]
+    rowbytes = (w + 7) // 8
+    px = {}
+    for i, bits in enumerate(g["rows"][:h]):
+        row = ascent - (yo + h - i)         # cell row, 0 = top
+        if row < 0 or row >= height:
+            continue
+        for x in range(w):
+            if bits & (1 << (rowbytes * 8 - 1 - x)):
+                px[(xo + x, row)] = 1
+    return px
+
+
+def downsample(px, scale, bpp):
+    """Box-filter N x N source pixels into one coverage value 0..2^bpp-1."""
+    if scale == 1 and bpp == 1:
+        return px
+    top = (1 << bpp) - 1
+    count = {}
+    for (x, row) in px:
+        key = (x // scale, row // scale)
+        count[key] = count.get(key, 0) + 1
+    cov = {}
+    for key, n in count.items():
+        v = (n * top + scale * scale // 2) // (scale * scale)
+        if v:
+            cov[key] = v
+    return cov
+
+
+def pack_columns(cov, height, bpp):
+    """Crop to the ink and pack column-major. Returns (xoff, width, bytes)."""
+    if not cov:
+        return 0, 0, []
+    xs = [x for (x, _) in cov]
+    x0, x1 = min(xs), max(xs)
+    colbytes = (height * bpp + 7) // 8
+    out = []
+    for x in range(x0, x1 + 1):
+        col = [0] * colbytes
+        for row in range(height):
+            bit = row * bpp
+            col[bit >> 3] |= cov.get((x, row), 0) << (bit & 7)
+        out.extend(col)
+    return x0, x1 - x0 + 1, out
+
+
+def c_char(code):
+    c = chr(code)
+    return "\\" + c if c in "\\'" else c
+
+
+def parse_kern(path):
+    pairs = {}
+    with open(path, encoding="utf-8") as f:
+        for n, line in enumerate(f, 1):
+            if not line.strip() or line.startswith("#"):
+                continue
+            if len(line) < 4 or line[2] != " ":
+                sys.exit("%s:%d: expected 'LR adjust'" % (path, n))
+            pairs[(ord(line[0]), ord(line[1]))] = int(line[3:].split()[0])
+    return pairs
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__.split("\n")[1])
+    ap.add_argument("bdf")
+    ap.add_argument("-n", "--name", required=True, help="C name of the PFont")
+    ap.add_argument("-o", "--output", required=True)
+    ap.add_argument("-k", "--kern", help="kerning pair file")
+    ap.add_argument("--first", type=int, default=32)
+    ap.add_argument("--last", type=int, default=126)
+    ap.add_argument("--bpp", type=int, choices=(1, 2, 4), default=1,
+                    help="bits per pixel, 2 and 4 give anti-aliased glyphs")
+    ap.add_argument("--scale", type=int, default=1,
+                    help="shrink the BDF by this factor")
+    args = ap.parse_args()
+
+    ascent, descent, glyphs = parse_bdf(args.bdf)
+    srcheight = ascent + descent
+    sc = args.scale
+    height = (srcheight + sc - 1) // sc
+    if height > 16:
+        sys.exit("font is %d px high, PFONT_MAX_HEIGHT is 16" % height)
+
+    bitmap, table = [], []
+    for enc in range(args.first, args.last + 1):
+        g = glyphs.get(enc)
+        if g is None:       # missing glyphs render as empty cells
+            table.append((len(bitmap), 0, 0, 0, enc))
+            continue
+        cov = downsample(glyph_pixels(g, ascent, srcheight), sc, args.bpp)
+        xoff, width, cols = pack_columns(cov, height, args.bpp)
+        table.append((len(bitmap), width, (g["dwidth"] + sc // 2) // sc, xoff, enc))
+        bitmap.extend(cols)
+    if len(bitmap) > 0xFFFF:
+        sys.exit("bitmap too large for 16-bit offsets")
+
+    kern = []
+    if args.kern:
+        for (l, r), adj in sorted(parse_kern(args.kern).items()):
+            if args.first <= l <= args.last and args.first <= r <= args.last and adj:
+                kern.append((l, r, adj // sc))
+        kern = [k for k in kern if k[2]]
+
+    name = args.name
+    guard = "__" + name.upper() + "_H"
+    o = []
+    o.append("// Generated by tools/bdf2pfont.py from %s - do not edit." % args.bdf.split("/")[-1])
+    o.append("// %d glyphs (0x%02X-0x%02X), %d px high, %d bpp, %d bitmap bytes, %d kerning pairs"
+             % (len(table), args.first, args.last, height, args.bpp, len(bitmap), len(kern)))
+    o.append("")
+    o.append("#ifndef %s" % guard)
+    o.append("#define %s" % guard)
+    o.append("")
+    o.append('#include "lcd/pfont.h"')
+    o.append("")
+    o.append("static const uint8_t %s_bitmap[%d] = {" % (name, max(len(bitmap), 1)))
+    colbytes = (height * args.bpp + 7) // 8
+    for off, width, adv, xoff, enc in table:
+        if width:
+            data = bitmap[off:off + width * colbytes]
+            o.append("\t" + ",".join("0x%02X" % b for b in data) + ",\t// 0x%02X" % enc)
+    if not bitmap:
+        o.append("\t0x00")
+    o.append("};")
+    o.append("")
+    o.append("static const PFontGlyph %s_glyphs[%d] = {" % (name, len(table)))
+    for off, width, adv, xoff, enc in table:
+        ch = chr(enc) if 32 < enc < 127 and chr(enc) not in "\\'" else " "
+        o.append("\t{%5d,%3d,%3d,%3d },\t// 0x%02X %s" % (off, width, adv, xoff, enc, ch))
+    o.append("};")
+    o.append("")
+    if kern:
+        o.append("static const PFontKern %s_kern[%d] = {" % (name, len(kern)))
+        for l, r, adj in kern:
+            o.append("\t{ '%s','%s',%3d }," % (c_char(l), c_char(r), adj))
+        o.append("};")
+        o.append("")
+    o.append("const PFont %s = {" % name)
+    o.append("\t%s_bitmap," % name)
+    o.append("\t%s_glyphs," % name)
+    o.append("\t%s," % ((name + "_kern") if kern else "0"))
+    o.append("\t%d,\t\t// kerning pairs" % len(kern))
+    o.append("\t0x%02X, 0x%02X,\t// first, last" % (args.first, args.last))
+    o.append("\t%d,\t\t// height" % height)
+    o.append("\t%d,\t\t// baseline" % (ascent // sc))
+    o.append("\t%d\t\t// bits per pixel" % args.bpp)
+    o.append("};")
+    o.append("")
+    o.append("#endif")
+    with open(args.output, "w") as f:
+        f.write("\n".join(o) + "\n")
+
+
+if __name__ == "__main__":
+    main()
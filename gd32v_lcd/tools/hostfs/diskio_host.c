@@ -0,0 +1,179 @@
+/*-----------------------------------------------------------------------*/
+/* Host backend for the FatFs disk interface                             */
+/*-----------------------------------------------------------------------*/
+/*
+/  Takes the place of tf_card.c when FatFs is built for Linux: the drive is
+/  a FAT image file, mapped into memory. Every access is charged to a cost
+/  model of the card on SPI (HostLatency), so FatFs workloads can be timed
+/  and counted on the host with real images. Reads go through the same
+/  sector cache as on the board (blkcache.c), so its counters mean the
+/  same thing.
+/
+/  Writes go to the image only if it was opened writable; otherwise the
+/  mapping is private and the file stays as it is.
+/----------------------------------------------------------------------*/
+
+#include <fcntl.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "diskio_host.h"
+#include "fatfs/blkcache.h"
+
+HostLatency host_lat = {
+	100.0,		/* cmd_us */
+	296.0,		/* byte_ns: 8 clocks at 27MHz */
+	500.0,		/* write_us */
+	1			/* stream */
+};
+
+static BYTE *img;				/* Mapped image */
+static DWORD img_sectors;
+static DWORD next_sector = 0xFFFFFFFF;	/* Sector after the last read */
+static HostStats st;
+
+
+int host_disk_open (
+	const char *image,	/* Image file */
+	int writable		/* 1: writes go to the file */
+)
+{
+	struct stat sb;
+	int fd = open(image, writable ? O_RDWR : O_RDONLY);
+
+	if (fd < 0) return -1;
+	if (fstat(fd, &sb) < 0) {
+		close(fd);
+		return -1;
+	}
+	img = mmap(0, sb.st_size, PROT_READ | PROT_WRITE, writable ? MAP_SHARED : MAP_PRIVATE, fd, 0);
+	close(fd);
+	if (img == MAP_FAILED) {
+		img = 0;
+		return -1;
+	}
+	img_sectors = (DWORD)(sb.st_size / 512);
+	return 0;
+}
+
+
+void host_disk_close (void)
+{
+	if (img) munmap(img, (size_t)img_sectors * 512);
+	img = 0;
+}
+
+
+const HostStats *host_disk_stats (void)
+{
+	return &st;
+}
+
+
+void host_disk_reset_stats (void)
+{
+	memset(&st, 0, sizeof st);
+}
+
+
+/* The card: copy and charge the time */
+static
+DRESULT host_read (
+	BYTE *buff,
+	DWORD sector,
+	UINT count
+)
+{
+	if (sector >= img_sectors || count > img_sectors - sector) return RES_PARERR;
+	memcpy(buff, img + (size_t)sector * 512, (size_t)count * 512);
+	st.reads++;
+	st.sectors_read += count;
+	if (!host_lat.stream || sector != next_sector) {
+		st.cmds++;
+		st.us += host_lat.cmd_us;
+	}
+	st.us += count * (512 + 2) * host_lat.byte_ns / 1000;	/* Data and CRC */
+	next_sector = sector + count;
+	return RES_OK;
+}
+
+
+DSTATUS disk_initialize (
+	BYTE drv
+)
+{
+	if (drv || !img) return STA_NOINIT;
+	blkcache_init(host_read);
+	next_sector = 0xFFFFFFFF;
+	return 0;
+}
+
+
+DSTATUS disk_status (
+	BYTE drv
+)
+{
+	return (drv || !img) ? STA_NOINIT : 0;
+}
+
+
+DRESULT disk_read (
+	BYTE drv,
+	BYTE *buff,
+	DWORD sector,
+	UINT count
+)
+{
+	if (drv || !count) return RES_PARERR;
+	if (!img) return RES_NOTRDY;
+
+	return blkcache_read(buff, sector, count);
+}
+
+
+#if FF_FS_READONLY == 0
+DRESULT disk_write (
+	BYTE drv,
+	const BYTE *buff,
+	DWORD sector,
+	UINT count
+)
+{
+	if (drv || !count) return RES_PARERR;
+	if (!img) return RES_NOTRDY;
+	if (sector >= img_sectors || count > img_sectors - sector) return RES_PARERR;
+
+	blkcache_invalidate(sector, count);
+	memcpy(img + (size_t)sector * 512, buff, (size_t)count * 512);
+	st.writes++;
+	st.sectors_written += count;
+	st.cmds++;
+	st.us += host_lat.cmd_us + count * ((512 + 2) * host_lat.byte_ns / 1000 + host_lat.write_us);
+	next_sector = 0xFFFFFFFF;			/* Ends a read stream on the card */
+	return RES_OK;
+}
+#endif
+
+
+DRESULT disk_ioctl (
+	BYTE drv,
+	BYTE cmd,
+	void *buff
+)
+{
+	if (drv) return RES_PARERR;
+	if (!img) return RES_NOTRDY;
+
+	switch (cmd) {
+	case CTRL_SYNC :
+		return RES_OK;
+	case GET_SECTOR_COUNT :
+		*(DWORD*)buff = img_sectors;
+		return RES_OK;
+	case GET_BLOCK_SIZE :
+		*(DWORD*)buff = 1;
+		return RES_OK;
+	}
+	return RES_PARERR;
+}
@@ -0,0 +1,34 @@
+/*-----------------------------------------------------------------------/
+/  Host backend for the FatFs disk interface: a FAT image file           /
+/-----------------------------------------------------------------------*/
+
+#ifndef _DISKIO_HOST_H_
+#define _DISKIO_HOST_H_
+
+#include "fatfs/diskio.h"
+
+/* SD card over SPI, as a cost model. Times are added up, not waited for. */
+typedef struct {
+	double cmd_us;		/* Per command: access time until the data token */
+	double byte_ns;		/* Per byte on the bus (8 clocks) */
+	double write_us;	/* Per written block: programming busy time */
+	int stream;			/* 1: a read that continues the last one costs no command (like tf_card.c) */
+} HostLatency;
+
+typedef struct {
+	unsigned long cmds;			/* Read and write commands */
+	unsigned long reads;		/* disk_read calls that reached the card */
+	unsigned long sectors_read;
+	unsigned long writes;
+	unsigned long sectors_written;
+	double us;					/* Modelled card time */
+} HostStats;
+
+extern HostLatency host_lat;	/* Defaults: 27MHz SPI, 100us access time */
+
+int host_disk_open (const char *image, int writable);	/* 0:OK, -1:Error (errno) */
+void host_disk_close (void);
+const HostStats *host_disk_stats (void);
+void host_disk_reset_stats (void);
+
+#endif
@@ -0,0 +1,327 @@
+/*-----------------------------------------------------------------------*/
+/* FatFs workloads on a FAT image, on the host                           */
+/*-----------------------------------------------------------------------*/
+/*
+/  Runs the firmware's FatFs, sector cache and the access patterns of the
+/  player and the logger against a FAT image, and reports the modelled card
+/  time (see diskio_host.c) together with the counters.
+/
+/  Build, from gd32v_lcd/:
+/    gcc -O2 -Wall -Iinclude -Iinclude/fatfs -Isrc -o hostbench \
+/        tools/hostfs/hostbench.c tools/hostfs/diskio_host.c \
+/        src/fatfs/ff.c src/fatfs/blkcache.c src/manifest.c src/logger.c \
+/        src/rawlog.c
+/
+/  Usage:
+/    ./hostbench [-c cmd_us] [-b byte_ns] [-n] [-m MANIFEST] [-w] IMAGE play [FILE [SKIP]]
+/        Video player: FILE (bmp.bin) in 6400-byte bands, 4 per frame.
+/        With SKIP, every SKIPth frame is late and skipped with f_lseek.
+/    ./hostbench ... IMAGE open NAME [NAME...]
+/        Open and close each file 100 times (directory lookups).
+/    ./hostbench ... IMAGE dir [DIR [COUNT]]
+/        Creates DIR/D0000.BIN... (COUNT, 300) where missing, in an existing
+/        DIR (root), then opens each 10 times, and as many names that are not
+/        there. Directory lookups in a directory of more than 192 names.
+/    ./hostbench ... IMAGE seek FILE
+/        1000 reads of 512 bytes at random offsets.
+/    ./hostbench ... IMAGE log FILE [LEN [COUNT]]
+/        COUNT (10000) records of LEN (24) bytes, one every 10ms, through
+/        logger.c; then the same records with one f_write each into
+/        DIRECT.LOG, synced as often. Shows sectors written per data byte.
+/    ./hostbench ... IMAGE rawlog FILE [SECTORS [COUNT]]
+/        Opens (or creates with SECTORS data sectors, 2048) a pre-allocated
+/        log with rawlog.c and appends COUNT (1000) sectors, one at a time.
+/  -n: no read streaming in the card model (every read pays cmd_us).
+/  -m MANIFEST: open the files through the asset manifest on the image
+/     (see tools/mkmanifest.py), as the firmware does.
+/  -w: write to the image file. Without it, writes only change a private
+/     copy in memory and the file stays as it is.
+/----------------------------------------------------------------------*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "fatfs/ff.h"
+#include "fatfs/blkcache.h"
+#include "diskio_host.h"
+#include "manifest.h"
+#include "logger.h"
+#include "rawlog.h"
+
+#define FRAME_SIZE	25600		/* 160x80 RGB565, as in lcd.h */
+#define BAND		(FRAME_SIZE / 4)
+
+static FATFS fs;
+static FIL fil;
+static BYTE buf[BAND];
+static const char *mf;		/* Asset manifest, or 0 */
+
+volatile uint32_t systick_ms;	/* Simulated time, for logger.c */
+
+
+static FRESULT open_file (FIL *fp, const char *name)
+{
+	return mf ? manifest_open(fp, name) : f_open(fp, name, FA_READ);
+}
+
+
+static int play (const char *name, int skip)
+{
+	UINT br;
+	unsigned long frames = 0, skipped = 0;
+	int band;
+	FRESULT fr = open_file(&fil, name);
+
+	if (fr) return fr;
+	for (;;) {
+		for (band = 0; band < 4; band++) {
+			fr = f_read(&fil, buf, BAND, &br);
+			if (fr || br < BAND) break;
+		}
+		if (band < 4) break;
+		frames++;
+		if (skip && frames % skip == 0) {		/* Late: skip the next frame */
+			if (f_tell(&fil) + FRAME_SIZE >= f_size(&fil)) break;
+			f_lseek(&fil, f_tell(&fil) + FRAME_SIZE);
+			skipped++;
+		}
+	}
+	f_close(&fil);
+	printf("play %s: %lu frames shown, %lu skipped\n", name, frames, skipped);
+	if (frames) {
+		double us = host_disk_stats()->us / frames;
+		printf("  %.0f us card time per frame, %.1f fps at most\n", us, 1e6 / us);
+	}
+	return fr;
+}
+
+
+static int open_files (char **names, int n)
+{
+	int i, r;
+	FRESULT fr;
+
+	for (r = 0; r < 100; r++) {
+		for (i = 0; i < n; i++) {
+			fr = open_file(&fil, names[i]);
+			if (fr) {
+				printf("open %s: error %d\n", names[i], fr);
+				return fr;
+			}
+			f_close(&fil);
+		}
+	}
+	printf("open: %d files x 100\n  %.1f us card time per open\n", n, host_disk_stats()->us / (n * 100));
+	return 0;
+}
+
+
+static int dir_names (const char *dir, int count)
+{
+	char name[32];
+	int i, r;
+	double us;
+	FRESULT fr;
+
+	if (strlen(dir) > 16) return FR_INVALID_NAME;
+	for (i = 0; i < count; i++) {		/* Create the files that are not there yet */
+		sprintf(name, "%s/D%04d.BIN", dir, i);
+		fr = f_open(&fil, name, FA_WRITE | FA_OPEN_ALWAYS);
+		if (fr) {
+			printf("create %s: error %d\n", name, fr);
+			return fr;
+		}
+		f_close(&fil);
+	}
+	host_disk_reset_stats();
+	for (r = 0; r < 10; r++) {
+		for (i = 0; i < count; i++) {
+			sprintf(name, "%s/D%04d.BIN", dir, i);
+			fr = f_open(&fil, name, FA_READ);
+			if (fr) {
+				printf("open %s: error %d\n", name, fr);
+				return fr;
+			}
+			f_close(&fil);
+		}
+	}
+	us = host_disk_stats()->us;
+	for (r = 0; r < 10; r++) {
+		for (i = 0; i < count; i++) {
+			sprintf(name, "%s/M%04d.BIN", dir, i);
+			fr = f_open(&fil, name, FA_READ);
+			if (fr != FR_NO_FILE) {
+				printf("open %s: %d, not FR_NO_FILE\n", name, fr);
+				return fr ? fr : FR_INT_ERR;
+			}
+		}
+	}
+	printf("dir %s: %d names x 10\n", *dir ? dir : "/", count);
+	printf("  %.1f us card time per open, %.1f us per name that is not there\n",
+	       us / (count * 10), (host_disk_stats()->us - us) / (count * 10));
+	return 0;
+}
+
+
+static int seek (const char *name)
+{
+	UINT br;
+	int i;
+	FRESULT fr = open_file(&fil, name);
+
+	if (fr) return fr;
+	srand(1);
+	for (i = 0; i < 1000 && !fr; i++) {
+		fr = f_lseek(&fil, (FSIZE_t)((double)rand() / RAND_MAX * (f_size(&fil) - 512)));
+		if (!fr) fr = f_read(&fil, buf, 512, &br);
+	}
+	f_close(&fil);
+	if (fr) printf("seek %s: error %d after %d reads\n", name, fr, i);
+	printf("seek %s: 1000 reads\n  %.1f us card time per read\n", name, host_disk_stats()->us / 1000);
+	return fr;
+}
+
+
+static void log_report (const char *what, unsigned long bytes, unsigned long recs)
+{
+	const HostStats *hs = host_disk_stats();
+
+	printf("%s: %lu records, %lu bytes\n", what, recs, bytes);
+	printf("  %lu sectors written in %lu commands, %.2f bytes on the card per byte logged\n",
+	       hs->sectors_written, hs->writes, (double)hs->sectors_written * 512 / bytes);
+	printf("  %.1f ms card time, %.1f kB/s\n", hs->us / 1000, bytes / hs->us * 1e6 / 1024);
+}
+
+
+static int log_records (const char *name, int len, long count)
+{
+	static Logger lg;
+	char rec[256];
+	long n;
+	UINT bw;
+	FRESULT fr;
+
+	if (len < 2 || len > (int)sizeof rec) return FR_INVALID_PARAMETER;
+	memset(rec, '.', len);
+	rec[len - 1] = '\n';
+
+	/* Buffered: whole sectors, f_sync every LOG_SYNC_MS */
+	fr = log_open(&lg, name);
+	for (n = 0; n < count && !fr; n++) {
+		systick_ms += 10;
+		memcpy(rec, &n, sizeof n);
+		fr = log_write(&lg, rec, len);
+	}
+	if (!fr) fr = log_close(&lg);
+	if (fr) {
+		printf("log %s: error %d\n", name, fr);
+		return fr;
+	}
+	log_report("logger.c", lg.bytes, count);
+	printf("  %lu sectors handed to f_write, %lu syncs\n", (unsigned long)lg.sectors, (unsigned long)lg.syncs);
+
+	/* The same records, one f_write each */
+	host_disk_reset_stats();
+	fr = f_open(&fil, "DIRECT.LOG", FA_WRITE | FA_OPEN_APPEND);
+	for (n = 0; n < count && !fr; n++) {
+		memcpy(rec, &n, sizeof n);
+		fr = f_write(&fil, rec, len, &bw);
+		if (!fr && n % (LOG_SYNC_MS / 10) == LOG_SYNC_MS / 10 - 1) fr = f_sync(&fil);
+	}
+	if (!fr) fr = f_close(&fil);
+	if (fr) {
+		printf("log DIRECT.LOG: error %d\n", fr);
+		return fr;
+	}
+	log_report("f_write per record", (unsigned long)count * len, count);
+	return 0;
+}
+
+
+static int rawlog_sectors (const char *name, DWORD sectors, long count)
+{
+	static RawLog rl;
+	DWORD fill;
+	long n;
+	FRESULT fr;
+
+	fr = rawlog_open(&rl, name, sectors);
+	if (fr) {
+		printf("rawlog %s: open error %d\n", name, fr);
+		return fr;
+	}
+	printf("rawlog %s: %lu of %lu sectors used, header at LBA %lu\n", name,
+	       (unsigned long)rl.hdr.fill, (unsigned long)rl.hdr.sectors, (unsigned long)rl.lba);
+	host_disk_reset_stats();
+	fill = rl.hdr.fill;
+	for (n = 0; n < count && !fr; n++) {
+		memset(buf, (BYTE)n, 512);
+		fr = rawlog_write(&rl, buf, 1);
+	}
+	n = rl.hdr.fill - fill;
+	if (!fr) fr = rawlog_sync(&rl);
+	if (fr) printf("rawlog %s: error %d after %ld sectors\n", name, fr, n);
+	log_report("rawlog.c", (unsigned long)n * 512, n);
+	return fr;
+}
+
+
+int main (int argc, char **argv)
+{
+	const BlkCacheStats *bs;
+	const HostStats *hs;
+	int i = 1, r = 1, wr = 0;
+
+	for (; i < argc && argv[i][0] == '-'; i++) {
+		if (!strcmp(argv[i], "-c") && i + 1 < argc) host_lat.cmd_us = atof(argv[++i]);
+		else if (!strcmp(argv[i], "-b") && i + 1 < argc) host_lat.byte_ns = atof(argv[++i]);
+		else if (!strcmp(argv[i], "-n")) host_lat.stream = 0;
+		else if (!strcmp(argv[i], "-m") && i + 1 < argc) mf = argv[++i];
+		else if (!strcmp(argv[i], "-w")) wr = 1;
+		else break;
+	}
+	if (argc - i < 2) {
+		fprintf(stderr, "usage: %s [-c cmd_us] [-b byte_ns] [-n] [-m MANIFEST] [-w] IMAGE play|open|dir|seek|log|rawlog ...\n", argv[0]);
+		return 2;
+	}
+	if (host_disk_open(argv[i], wr)) {
+		perror(argv[i]);
+		return 1;
+	}
+	if (f_mount(&fs, "", 1)) {
+		fprintf(stderr, "%s: no FAT volume\n", argv[i]);
+		return 1;
+	}
+	blkcache_pin(fs.fatbase, fs.fsize);		/* As main.c does */
+	if (fs.fs_type != FS_FAT32) blkcache_pin(fs.dirbase, fs.database - fs.dirbase);
+	if (mf && manifest_load(mf)) {
+		fprintf(stderr, "%s: no manifest for this volume\n", mf);
+		return 1;
+	}
+	host_disk_reset_stats();
+
+	if (!strcmp(argv[i + 1], "play")) {
+		r = play(argc > i + 2 ? argv[i + 2] : "bmp.bin", argc > i + 3 ? atoi(argv[i + 3]) : 0);
+	} else if (!strcmp(argv[i + 1], "open") && argc > i + 2) {
+		r = open_files(argv + i + 2, argc - i - 2);
+	} else if (!strcmp(argv[i + 1], "dir")) {
+		r = dir_names(argc > i + 2 ? argv[i + 2] : "", argc > i + 3 ? atoi(argv[i + 3]) : 300);
+	} else if (!strcmp(argv[i + 1], "seek") && argc > i + 2) {
+		r = seek(argv[i + 2]);
+	} else if (!strcmp(argv[i + 1], "log") && argc > i + 2) {
+		r = log_records(argv[i + 2], argc > i + 3 ? atoi(argv[i + 3]) : 24, argc > i + 4 ? atol(argv[i + 4]) : 10000);
+	} else if (!strcmp(argv[i + 1], "rawlog") && argc > i + 2) {
+		r = rawlog_sectors(argv[i + 2], argc > i + 3 ? atol(argv[i + 3]) : 2048, argc > i + 4 ? atol(argv[i + 4]) : 1000);
+	} else {
+		fprintf(stderr, "unknown workload %s\n", argv[i + 1]);
+	}
+
+	hs = host_disk_stats();
+	bs = blkcache_stats();
+	printf("card: %lu commands, %lu reads (%lu sectors), %lu writes, %.1f ms\n",
+	       hs->cmds, hs->reads, hs->sectors_read, hs->writes, hs->us / 1000);
+	printf("sector cache: hits %lu, misses %lu, evictions %lu, bypass %lu\n",
+	       (unsigned long)bs->hits, (unsigned long)bs->misses, (unsigned long)bs->evictions, (unsigned long)bs->bypass);
+	host_disk_close();
+	return r ? 1 : 0;
+}
@@ -0,0 +1,170 @@
+#!/usr/bin/env python3
+"""
+mkmanifest.py - list the start clusters of assets on a FAT card (see include/manifest.h).
+
+Usage:
+    python3 tools/mkmanifest.py -o assets.mf /dev/sdX logo.bin bmp.bin
+    cp assets.mf /media/card/
+
+The first argument is the card, or an image of it: a FAT12/16/32 volume,
+either on its own or in the first partition of an MBR. The others are the
+files to list, as paths from the root, in 8.3 names (the firmware is built
+without long file names).
+
+The manifest holds the volume serial number and cluster count, so the
+firmware ignores it on another (or a reformatted) card. Copying the
+manifest to the card does not move the assets; rewriting an asset may,
+so run the tool again after that.
+
+Format, little endian:
+    header: magic "AMF1", volume serial, data clusters, entry count (4 DWORDs)
+    entry:  name (20 bytes, upper case, NUL padded), start cluster, size,
+            flags (1: contiguous clusters)
+"""
+
+import argparse
+import struct
+import sys
+
+MAGIC = 0x31464D41
+NAME_LEN = 20
+FLAG_CONTIG = 0x01
+
+
+class Volume:
+    def __init__(self, f):
+        self.f = f
+        self.base = 0
+        bs = self.sector(0)
+        if not self.is_bpb(bs):                 # MBR: first partition
+            if bs[510:512] != b"\x55\xAA":
+                sys.exit("no FAT volume found")
+            self.base, = struct.unpack_from("<I", bs, 446 + 8)
+            bs = self.sector(0)
+            if not self.is_bpb(bs):
+                sys.exit("no FAT volume in the first partition")
+        (self.bps, self.csize, rsvd, nfats, self.nroot,
+         tot16, fsz16, tot32) = struct.unpack_from("<HBHBHHxH8xI", bs, 11)
+        if self.bps != 512:
+            sys.exit("sector size %d, the firmware needs 512" % self.bps)
+        fsize = fsz16 or struct.unpack_from("<I", bs, 36)[0]
+        total = tot16 or tot32
+        self.fatbase = rsvd
+        self.dirbase = rsvd + nfats * fsize
+        self.database = self.dirbase + (self.nroot * 32 + 511) // 512
+        self.clusters = (total - self.database) // self.csize
+        # Same rule as FatFs
+        self.fat = 12 if self.clusters <= 4085 else 16 if self.clusters <= 65525 else 32
+        self.vsn, = struct.unpack_from("<I", bs, 67 if self.fat == 32 else 39)
+        self.rootclus = struct.unpack_from("<I", bs, 44)[0] if self.fat == 32 else 0
+        self.fattab = b"".join(self.sector(self.fatbase + i) for i in range(fsize))
+
+    @staticmethod
+    def is_bpb(bs):
+        return (bs[0] in (0xEB, 0xE9) and bs[510:512] == b"\x55\xAA"
+                and struct.unpack_from("<H", bs, 11)[0] in (512, 1024, 2048, 4096))
+
+    def sector(self, lba):
+        self.f.seek((self.base + lba) * 512)
+        data = self.f.read(512)
+        if len(data) < 512:
+            sys.exit("sector %d is beyond the end of the card" % lba)
+        return data
+
+    def next(self, clst):
+        if self.fat == 12:
+            v, = struct.unpack_from("<H", self.fattab, clst + clst // 2)
+            return v >> 4 if clst & 1 else v & 0xFFF
+        if self.fat == 16:
+            return struct.unpack_from("<H", self.fattab, clst * 2)[0]
+        return struct.unpack_from("<I", self.fattab, clst * 4)[0] & 0x0FFFFFFF
+
+    def chain(self, clst):
+        out = []
+        while 2 <= clst < self.clusters + 2:
+            out.append(clst)
+            if len(out) > self.clusters:
+                sys.exit("cluster chain loops at %d" % clst)
+            clst = self.next(clst)
+        return out
+
+    def dir_sectors(self, clst):
+        if clst == 0 and self.fat != 32:        # FAT12/16 root: fixed area
+            return range(self.dirbase, self.database)
+        if clst == 0:
+            clst = self.rootclus
+        return [self.database + (c - 2) * self.csize + i
+                for c in self.chain(clst) for i in range(self.csize)]
+
+    def find(self, clst, sfn):
+        for lba in self.dir_sectors(clst):
+            sec = self.sector(lba)
+            for off in range(0, 512, 32):
+                ent = sec[off:off + 32]
+                if ent[0] == 0:
+                    return None
+                if ent[0] == 0xE5 or ent[11] & 0x08:    # Deleted, LFN or label
+                    continue
+                if ent[:11] == sfn:
+                    hi, lo, size = struct.unpack_from("<H4xHI", ent, 20)
+                    return ent[11], (hi << 16 | lo) if self.fat == 32 else lo, size
+        return None
+
+
+def sfn(name):
+    body, _, ext = name.upper().partition(".")
+    if not body or len(body) > 8 or len(ext) > 3 or "." in ext:
+        sys.exit("'%s' is not an 8.3 name" % name)
+    s = (body.ljust(8) + ext.ljust(3)).encode("ascii")
+    return b"\x05" + s[1:] if s[0] == 0xE5 else s
+
+
+def resolve(vol, path):
+    clst, attr, size = 0, 0x10, 0
+    for part in [p for p in path.split("/") if p]:
+        if not attr & 0x10:
+            sys.exit("%s: '%s' is not a directory" % (path, part))
+        hit = vol.find(clst, sfn(part))
+        if not hit:
+            sys.exit("%s: not found" % path)
+        attr, clst, size = hit
+    if attr & 0x10:
+        sys.exit("%s: is a directory" % path)
+    return clst, size
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__.split("\n")[1])
+    ap.add_argument("-o", "--output", default="assets.mf")
+    ap.add_argument("card")
+    ap.add_argument("files", nargs="+")
+    args = ap.parse_args()
+
+    with open(args.card, "rb") as f:
+        vol = Volume(f)
+        entries = []
+        for path in args.files:
+            name = path.strip("/").upper()
+            if len(name) >= NAME_LEN:
+                sys.exit("%s: name longer than %d characters" % (path, NAME_LEN - 1))
+            clst, size = resolve(vol, name)
+            need = (size + vol.csize * 512 - 1) // (vol.csize * 512)
+            chain = vol.chain(clst)[:need]
+            if len(chain) < need:
+                sys.exit("%s: cluster chain shorter than the file" % path)
+            contig = all(b == a + 1 for a, b in zip(chain, chain[1:]))
+            entries.append((name, clst, size, FLAG_CONTIG if contig else 0))
+
+    out = struct.pack("<4I", MAGIC, vol.vsn, vol.clusters, len(entries))
+    for name, clst, size, flags in entries:
+        out += struct.pack("<%dsIII" % NAME_LEN, name.encode("ascii"), clst, size, flags)
+    with open(args.output, "wb") as f:
+        f.write(out)
+    print("FAT%d, serial %04X-%04X, %d clusters of %d bytes"
+          % (vol.fat, vol.vsn >> 16, vol.vsn & 0xFFFF, vol.clusters, vol.csize * 512))
+    for name, clst, size, flags in entries:
+        print("%-20s cluster %7d %9d bytes%s" % (name, clst, size, ", contiguous" if flags else ""))
+
+
+if __name__ == "__main__":
+    main()
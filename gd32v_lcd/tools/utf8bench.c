@@ -0,0 +1,118 @@
+/**************************************************************************
+ * UTF-8 decode + glyph render throughput, on the host
+ * Code CC-BY untergeekDE
+ *
+ * Runs src/lcd/utf8.c the way LCD_ShowStringX uses it: UTF8_Next for each
+ * code point, then CP437_Glyph (8x8 BasicFont) or ASC16_Glyph (8x16
+ * asc2_1608), and expands the glyph into RGB565 pixels like LCD_printChar
+ * does for font sizes 0 and 1, here into a text line buffer instead of
+ * the bus. Three kinds of text: plain ASCII, German/symbol labels (2- and
+ * 3-byte sequences, table lookups), and raw CP437 bytes (invalid UTF-8,
+ * the escaped path). Decoding alone is timed too, to show its share.
+ *
+ * Build and run, from gd32v_lcd/:
+ *   gcc -O2 -Wall -Iinclude -o utf8bench tools/utf8bench.c src/lcd/utf8.c
+ *   ./utf8bench [MBYTES]
+ * The host is much faster than the 108MHz core; compare the kinds of text
+ * and before/after a change, not the absolute numbers.
+ * *******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "lcd/utf8.h"
+#include "lcd/oledfont.h"
+#include "lcd/8x8_vertikal_LSB_2.h"
+
+#define LINE_W	160				/* Landscape panel width, as in lcd.h */
+
+static uint16_t line[16][LINE_W];	/* One text line of RGB565 pixels */
+
+static const char *const texts[][2] = {
+	{ "ASCII",   "Temperature 23.5 C, humidity 41%, battery 3.92V " },
+	{ "UTF-8",   "Grüße ☺ 25°C ½ € Straße Ölstand ±0.5 µs → ░▒▓ " },
+	{ "raw 437", "\x81\x84\x94\xF8\xAB\xB0\xB1\xB2 CP437 bytes \xE1\x9C " },
+};
+
+static double now(void)
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+/* Decode (and with font 0 or 1, render) the text in buf; returns a checksum */
+static unsigned long run(const u8 *p, int font, unsigned long *cps)
+{
+	const uint16_t color = 0xFFFF, back = 0x001F;
+	unsigned long sum = 0, n = 0;
+	unsigned x = 0, xx, yy;
+	u32 c;
+
+	while ((c = UTF8_Next(&p)) != 0)
+	{
+		n++;
+		if (font < 0)
+		{
+			sum += CP437_Glyph(c);			/* Keep the lookup from being optimized away */
+			continue;
+		}
+		if (font == 0)					/* 8x8: a byte per column, LSB on top */
+		{
+			const unsigned char *g = BasicFont[CP437_Glyph(c)];
+			for (yy = 0; yy < 8; yy++)
+				for (xx = 0; xx < 8; xx++)
+					line[yy][x + xx] = ((1 << yy) & g[xx]) ? color : back;
+		}
+		else							/* 8x16: a byte per row, LSB on the left */
+		{
+			u8 g = ASC16_Glyph(c);
+			if (g < ' ' || g > 0x80) g = '?';	/* As LCD_printChar */
+			for (yy = 0; yy < 16; yy++)
+			{
+				unsigned t = asc2_1608[(g - ' ') * 16 + yy];
+				for (xx = 0; xx < 8; xx++, t >>= 1)
+					line[yy][x + xx] = (t & 1) ? color : back;
+			}
+		}
+		x += 8;
+		if (x >= LINE_W)					/* Line full: "send" it */
+		{
+			x = 0;
+			sum += line[0][3] + line[7][LINE_W - 1];
+		}
+	}
+	*cps = n;
+	return sum + line[5][17];
+}
+
+int main(int argc, char **argv)
+{
+	static const char *const what[] = { "decode", "8x8", "8x16" };
+	size_t size = (argc > 1 ? atol(argv[1]) : 16) << 20;
+	u8 *buf = malloc(size + 1);
+	unsigned k;
+	int font;
+
+	if (!buf) return 1;
+	for (k = 0; k < sizeof(texts) / sizeof(texts[0]); k++)
+	{
+		size_t len = strlen(texts[k][1]), i;
+
+		for (i = 0; i + len <= size; i += len) memcpy(buf + i, texts[k][1], len);
+		buf[i] = 0;
+		for (font = -1; font <= 1; font++)
+		{
+			unsigned long cps, sum;
+			double t = now();
+
+			sum = run(buf, font, &cps);
+			t = now() - t;
+			printf("%-8s %-6s %7.1f MB/s, %6.2f ns per glyph (%lu glyphs, sum %lu)\n",
+			       texts[k][0], what[font + 1], i / t / 1e6, t * 1e9 / cps, cps, sum);
+		}
+	}
+	free(buf);
+	return 0;
+}